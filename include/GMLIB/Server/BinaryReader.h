@@ -0,0 +1,256 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+// Engine independent and header only. Reads the BinaryStream encoding from a buffer it does not own or copy, strings
+// and NBT are returned as views into it. A failed read returns nothing and leaves the position unchanged.
+namespace GMLIB::Server {
+
+class BinaryReader {
+public:
+    // Nesting allowed in readNbt.
+    static constexpr int MAX_NBT_DEPTH = 512;
+
+protected:
+    std::string_view mData;
+    size_t           mPosition = 0;
+
+public:
+    explicit BinaryReader(std::string_view data) : mData(data) {}
+
+public:
+    std::string_view getData() const { return mData; }
+
+    size_t getPosition() const { return mPosition; }
+
+    size_t getRemaining() const { return mData.size() - mPosition; }
+
+    bool isEnd() const { return mPosition == mData.size(); }
+
+    bool setPosition(size_t position) {
+        if (position > mData.size()) {
+            return false;
+        }
+        mPosition = position;
+        return true;
+    }
+
+    bool skip(size_t size) {
+        if (size > getRemaining()) {
+            return false;
+        }
+        mPosition += size;
+        return true;
+    }
+
+    std::optional<std::string_view> readBytes(size_t size) {
+        if (size > getRemaining()) {
+            return {};
+        }
+        auto result  = mData.substr(mPosition, size);
+        mPosition   += size;
+        return result;
+    }
+
+public:
+    std::optional<bool> readBool() {
+        auto value = readUnsignedChar();
+        if (!value) {
+            return {};
+        }
+        return *value != 0;
+    }
+
+    std::optional<uint8_t> readByte() { return readUnsignedChar(); }
+
+    std::optional<uint8_t> readUnsignedChar() { return readFixed<uint8_t>(); }
+
+    std::optional<int16_t> readSignedShort() { return readFixed<int16_t>(); }
+
+    std::optional<uint16_t> readUnsignedShort() { return readFixed<uint16_t>(); }
+
+    std::optional<int32_t> readSignedInt() { return readFixed<int32_t>(); }
+
+    std::optional<uint32_t> readUnsignedInt() { return readFixed<uint32_t>(); }
+
+    std::optional<int64_t> readSignedInt64() { return readFixed<int64_t>(); }
+
+    std::optional<uint64_t> readUnsignedInt64() { return readFixed<uint64_t>(); }
+
+    std::optional<float> readFloat() { return readFixed<float>(); }
+
+    std::optional<double> readDouble() { return readFixed<double>(); }
+
+    std::optional<int32_t> readSignedBigEndianInt() {
+        auto value = readFixed<uint32_t>();
+        if (!value) {
+            return {};
+        }
+        auto bytes = *value;
+        return (int32_t)((bytes >> 24) | ((bytes >> 8) & 0xff00) | ((bytes << 8) & 0xff0000) | (bytes << 24));
+    }
+
+    std::optional<uint32_t> readUnsignedVarInt() {
+        auto start = mPosition;
+        auto value = readVarIntBits(5);
+        if (!value || *value > UINT32_MAX) {
+            mPosition = start;
+            return {};
+        }
+        return (uint32_t)*value;
+    }
+
+    std::optional<uint64_t> readUnsignedVarInt64() { return readVarIntBits(10); }
+
+    // Zigzag encoded.
+    std::optional<int32_t> readVarInt() {
+        auto start = mPosition;
+        auto value = readUnsignedVarInt();
+        if (!value) {
+            mPosition = start;
+            return {};
+        }
+        return (int32_t)((*value >> 1) ^ (~(*value & 1) + 1));
+    }
+
+    // Zigzag encoded.
+    std::optional<int64_t> readVarInt64() {
+        auto value = readUnsignedVarInt64();
+        if (!value) {
+            return {};
+        }
+        return (int64_t)((*value >> 1) ^ (~(*value & 1) + 1));
+    }
+
+    std::optional<std::string_view> readString() {
+        auto start = mPosition;
+        auto size  = readUnsignedVarInt();
+        if (!size || *size > getRemaining()) {
+            mPosition = start;
+            return {};
+        }
+        return readBytes(*size);
+    }
+
+    // One network NBT tag with its type and name, as written by GMLIB_BinaryStream::writeCompoundTag.
+    std::optional<std::string_view> readNbt() {
+        auto start = mPosition;
+        auto type  = readUnsignedChar();
+        if (!type || (*type != 0 && (!readString() || !skipNbtPayload(*type, 0)))) {
+            mPosition = start;
+            return {};
+        }
+        return mData.substr(start, mPosition - start);
+    }
+
+protected:
+    template <typename T>
+    std::optional<T> readFixed() {
+        static_assert(std::endian::native == std::endian::little);
+        if (sizeof(T) > getRemaining()) {
+            return {};
+        }
+        T value;
+        std::memcpy(&value, mData.data() + mPosition, sizeof(T));
+        mPosition += sizeof(T);
+        return value;
+    }
+
+    std::optional<uint64_t> readVarIntBits(int maxBytes) {
+        uint64_t value = 0;
+        for (int i = 0; i < maxBytes && mPosition + i < mData.size(); i++) {
+            auto byte = (uint8_t)mData[mPosition + i];
+            // The 10th byte only holds the highest bit of a 64 bit value.
+            if (i == 9 && byte > 0x01) {
+                return {};
+            }
+            value |= (uint64_t)(byte & 0x7f) << (7 * i);
+            if (!(byte & 0x80)) {
+                mPosition += i + 1;
+                return value;
+            }
+        }
+        return {};
+    }
+
+    bool skipNbtLength(size_t elementSize) {
+        auto size = readVarInt();
+        return size && *size >= 0 && skipNbtElements((size_t)*size, elementSize);
+    }
+
+    bool skipNbtElements(size_t count, size_t elementSize) {
+        if (elementSize) {
+            return count <= getRemaining() / elementSize && skip(count * elementSize);
+        }
+        // Varints, each at least one byte.
+        if (count > getRemaining()) {
+            return false;
+        }
+        for (size_t i = 0; i < count; i++) {
+            if (!readVarInt()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Network NBT: ints and longs, list and array sizes are zigzag varints, string sizes unsigned varints.
+    bool skipNbtPayload(uint8_t type, int depth) {
+        if (depth >= MAX_NBT_DEPTH) {
+            return false;
+        }
+        switch (type) {
+        case 1: // Byte
+            return skip(1);
+        case 2: // Short
+            return skip(2);
+        case 3: // Int
+            return (bool)readVarInt();
+        case 4: // Int64
+            return (bool)readVarInt64();
+        case 5: // Float
+            return skip(4);
+        case 6: // Double
+            return skip(8);
+        case 7: // ByteArray
+            return skipNbtLength(1);
+        case 8: // String
+            return (bool)readString();
+        case 9: { // List
+            auto elementType = readUnsignedChar();
+            auto size        = readVarInt();
+            if (!elementType || !size || *size < 0 || (size_t)*size > getRemaining()) {
+                return false;
+            }
+            for (int32_t i = 0; i < *size; i++) {
+                if (!skipNbtPayload(*elementType, depth + 1)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case 10: // Compound
+            while (true) {
+                auto childType = readUnsignedChar();
+                if (!childType) {
+                    return false;
+                }
+                if (*childType == 0) {
+                    return true;
+                }
+                if (!readString() || !skipNbtPayload(*childType, depth + 1)) {
+                    return false;
+                }
+            }
+        case 11: // IntArray
+            return skipNbtLength(0);
+        default:
+            return false;
+        }
+    }
+};
+
+} // namespace GMLIB::Server
@@ -0,0 +1,117 @@
+#pragma once
+#include "GMLIB/Server/BinaryReader.h"
+#include <mc/deps/core/mce/UUID.h>
+#include <mc/math/Vec2.h>
+#include <mc/math/Vec3.h>
+#include <mc/network/packet/ActorLink.h>
+#include <mc/world/actor/state/PropertySyncData.h>
+#include <mc/world/level/BlockPos.h>
+
+// Reads what GMLIB_BinaryStream writes, for example packets inspected in a hook. Header only, nothing is copied.
+class GMLIB_BinaryReader : public GMLIB::Server::BinaryReader {
+public:
+    explicit GMLIB_BinaryReader(std::string_view data) : BinaryReader(data) {}
+
+public:
+    std::optional<Vec3> readVec3() {
+        auto start = mPosition;
+        auto x     = readFloat();
+        auto y     = readFloat();
+        auto z     = readFloat();
+        if (!x || !y || !z) {
+            mPosition = start;
+            return {};
+        }
+        return Vec3{*x, *y, *z};
+    }
+
+    std::optional<Vec2> readVec2() {
+        auto start = mPosition;
+        auto x     = readFloat();
+        auto z     = readFloat();
+        if (!x || !z) {
+            mPosition = start;
+            return {};
+        }
+        return Vec2{*x, *z};
+    }
+
+    std::optional<BlockPos> readBlockPos() {
+        auto start = mPosition;
+        auto x     = readVarInt();
+        auto y     = readUnsignedVarInt();
+        auto z     = readVarInt();
+        if (!x || !y || !z) {
+            mPosition = start;
+            return {};
+        }
+        return BlockPos{*x, (int)*y, *z};
+    }
+
+    std::optional<mce::UUID> readUuid() {
+        auto start = mPosition;
+        auto a     = readUnsignedInt64();
+        auto b     = readUnsignedInt64();
+        if (!a || !b) {
+            mPosition = start;
+            return {};
+        }
+        mce::UUID uuid;
+        uuid.a = *a;
+        uuid.b = *b;
+        return uuid;
+    }
+
+    std::optional<ActorLink> readActorLink() {
+        auto start              = mPosition;
+        auto a                  = readVarInt64();
+        auto b                  = readVarInt64();
+        auto type               = readUnsignedChar();
+        auto immediate          = readBool();
+        auto passengerInitiated = readBool();
+        if (!a || !b || !type || !immediate || !passengerInitiated) {
+            mPosition = start;
+            return {};
+        }
+        ActorLink link;
+        link.A.id                = *a;
+        link.B.id                = *b;
+        link.type                = (decltype(link.type))*type;
+        link.mImmediate          = *immediate;
+        link.mPassengerInitiated = *passengerInitiated;
+        return link;
+    }
+
+    std::optional<PropertySyncData> readPropertySyncData() {
+        auto             start = mPosition;
+        PropertySyncData data;
+        if (!readPropertyEntries(data.mIntEntries, [this] { return readVarInt(); })
+            || !readPropertyEntries(data.mFloatEntries, [this] { return readFloat(); })) {
+            mPosition = start;
+            return {};
+        }
+        return data;
+    }
+
+private:
+    template <typename Entries, typename ReadValue>
+    bool readPropertyEntries(Entries& entries, ReadValue const& readValue) {
+        auto size = readUnsignedVarInt();
+        // Each entry takes at least two bytes.
+        if (!size || *size > getRemaining() / 2) {
+            return false;
+        }
+        entries.reserve(*size);
+        for (uint32_t i = 0; i < *size; i++) {
+            auto index = readUnsignedVarInt();
+            auto value = readValue();
+            if (!index || !value) {
+                return false;
+            }
+            auto& entry          = entries.emplace_back();
+            entry.mPropertyIndex = *index;
+            entry.mData          = *value;
+        }
+        return true;
+    }
+};
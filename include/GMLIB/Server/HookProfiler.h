@@ -0,0 +1,27 @@
+#pragma once
+#include "GMLIB/GMLIB.h"
+#include "nlohmann/json.hpp"
+
+namespace GMLIB::Server::HookProfiler {
+
+struct HookStatistics {
+    std::string           mName;
+    uint64_t              mCalls;
+    uint64_t              mTotalTime; // Nanoseconds, the original function is not included
+    uint64_t              mMaxTime;   // Nanoseconds
+    std::vector<uint64_t> mHistogram; // mHistogram[i]: calls that took [2^(i-1), 2^i) nanoseconds
+};
+
+GMLIB_API void setEnabled(bool enabled = true);
+
+GMLIB_API bool isEnabled();
+
+GMLIB_API void resetStatistics();
+
+GMLIB_API std::optional<HookStatistics> getStatistics(std::string const& hookName);
+
+GMLIB_API std::vector<HookStatistics> getAllStatistics();
+
+GMLIB_API nlohmann::json dumpJson();
+
+} // namespace GMLIB::Server::HookProfiler
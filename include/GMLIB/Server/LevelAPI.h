@@ -18,6 +18,36 @@ enum class FillMode : int {
     Destroy = 4
 };
 
+enum class FillJobStatus : int {
+    Pending   = 0,
+    Running   = 1,
+    Completed = 2,
+    Cancelled = 3
+};
+
+class FillJob {
+public:
+    virtual ~FillJob() = default;
+
+    virtual FillJobStatus getStatus() const = 0;
+
+    virtual bool isFinished() const = 0;
+
+    // Progress in [0, 1], by blocks visited
+    virtual float getProgress() const = 0;
+
+    virtual uint64_t getTotalBlocks() const = 0;
+
+    virtual uint64_t getProcessedBlocks() const = 0;
+
+    // Blocks filled so far, same meaning as the return value of fillBlocks
+    virtual int getFilledCount() const = 0;
+
+    virtual void cancel() = 0;
+};
+
+using FillJobCallback = std::function<void(FillJob& job)>;
+
 class GMLIB_Level : public Level {
 public:
     GMLIB_API static GMLIB_Level* getLevel();
@@ -40,6 +70,16 @@ public:
 
     GMLIB_API static void setFakeLevelName(std::string fakeName);
 
+    // Time spent on fill jobs in each level tick, in microseconds
+    GMLIB_API static void setFillJobTickBudget(uint microseconds = 5000);
+
+    GMLIB_API static uint getFillJobTickBudget();
+
+    // Filled blocks update their neighbours like setBlock does, disable it to skip liquid flow and redstone updates
+    GMLIB_API static void setFillNeighbourUpdates(bool enabled = true);
+
+    GMLIB_API static bool getFillNeighbourUpdates();
+
 public:
     GMLIB_API BlockSource* getBlockSource(DimensionType dimid);
 
@@ -133,12 +173,67 @@ public:
         unsigned short newTileData
     );
 
+    // Jobs are advanced subchunk by subchunk inside level tick, callback is called on the server thread.
+    GMLIB_API std::shared_ptr<FillJob> submitFillJob(
+        BlockPos        startpos,
+        BlockPos        endpos,
+        DimensionType   dimId,
+        Block*          block,
+        FillMode        mode     = FillMode::Replace,
+        FillJobCallback callback = nullptr
+    );
+
+    GMLIB_API std::shared_ptr<FillJob> submitFillJob(
+        BlockPos        startpos,
+        BlockPos        endpos,
+        DimensionType   dimId,
+        std::string     name,
+        unsigned short  tileData = 0,
+        FillMode        mode     = FillMode::Replace,
+        FillJobCallback callback = nullptr
+    );
+
+    GMLIB_API std::shared_ptr<FillJob> submitFillJob(
+        BlockPos        startpos,
+        BlockPos        endpos,
+        DimensionType   dimId,
+        Block*          newBlock,
+        Block*          oldBlock,
+        FillJobCallback callback = nullptr
+    );
+
+    GMLIB_API std::shared_ptr<FillJob> submitFillJob(
+        BlockPos        startpos,
+        BlockPos        endpos,
+        DimensionType   dimId,
+        std::string     oldName,
+        unsigned short  oldTileData,
+        std::string     newName,
+        unsigned short  newTileData,
+        FillJobCallback callback = nullptr
+    );
+
     GMLIB_API double getServerMspt();
 
     GMLIB_API float getServerAverageTps();
 
     GMLIB_API float getServerCurrentTps();
 
+    // MSPT percentiles and max over the last 60 seconds
+    GMLIB_API double getServerMsptP50();
+
+    GMLIB_API double getServerMsptP95();
+
+    GMLIB_API double getServerMsptP99();
+
+    GMLIB_API double getServerMaxMspt();
+
+    GMLIB_API float getServerTps1s();
+
+    GMLIB_API float getServerTps10s();
+
+    GMLIB_API float getServerTps60s();
+
     GMLIB_API void setFreezeTick(bool freeze = true);
 
     GMLIB_API bool isTickFreezed();
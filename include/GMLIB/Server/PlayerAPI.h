@@ -2,6 +2,85 @@
 #include "GMLIB/GMLIB.h"
 #include "GMLIB/Server/ActorAPI.h"
 #include "mc/world/actor/player/Player.h"
+#include <future>
+
+struct OfflineNbtBatchStatistics {
+    size_t mRecords       = 0; // Players written or deleted
+    size_t mBytes         = 0; // Encoded size of the written players
+    double mEncodeSeconds = 0;
+    double mWriteSeconds  = 0;
+
+    double getRecordsPerSecond() const {
+        auto seconds = mEncodeSeconds + mWriteSeconds;
+        return seconds > 0 ? (double)mRecords / seconds : 0;
+    }
+};
+
+struct SidebarStatistics {
+    uint64_t mUpdates = 0; // Sidebar changes sent to a player
+    uint64_t mPackets = 0;
+    uint64_t mBytes   = 0; // Packet payloads, without headers and compression
+};
+
+struct PacketQueueStatistics {
+    uint64_t mQueued     = 0; // Packets sent to players with the queue enabled
+    uint64_t mSent       = 0;
+    uint64_t mSuperseded = 0; // Packets dropped for a later packet replacing them
+    uint64_t mSavedBytes = 0;
+    uint64_t mFlushes    = 0;
+};
+
+using OfflineNbtCallback = std::function<void(std::unique_ptr<CompoundTag> nbt)>;
+
+// Collects offline player edits, encodes them in parallel and writes them with one DB write batch.
+// Either every edit is written or none is. Edits of the same player are applied in order.
+class OfflineNbtBatch {
+public:
+    // Called on the committing thread with the players encoded so far.
+    using ProgressCallback = std::function<void(size_t encoded, size_t total)>;
+
+private:
+    struct Entry {
+        std::string                  mServerId;
+        std::unique_ptr<CompoundTag> mNbt;
+        std::vector<std::string>     mTags; // Tags merged into the stored player, empty replaces the whole player
+    };
+
+    std::vector<Entry>        mEntries;
+    ProgressCallback          mProgressCallback;
+    OfflineNbtBatchStatistics mStatistics;
+
+public:
+    GMLIB_API OfflineNbtBatch();
+
+    OfflineNbtBatch(OfflineNbtBatch const&)            = delete;
+    OfflineNbtBatch& operator=(OfflineNbtBatch const&) = delete;
+
+    GMLIB_API ~OfflineNbtBatch();
+
+public:
+    // The tag is copied.
+    GMLIB_API void setNbt(std::string const& serverId, CompoundTag const& nbt);
+
+    // Same as GMLIB_Player::setPlayerNbtTags, the player must already be stored.
+    GMLIB_API void
+    setNbtTags(std::string const& serverId, CompoundTag const& nbt, std::vector<std::string> const& tags);
+
+    GMLIB_API void deleteNbt(std::string const& serverId);
+
+    GMLIB_API size_t size() const;
+
+    GMLIB_API void clear();
+
+    GMLIB_API void setProgressCallback(ProgressCallback callback);
+
+    // Encodes on threads besides the calling one, 0 picks one per core. The edits are cleared on success.
+    // Returns false without writing anything when a player can not be loaded or encoded.
+    GMLIB_API bool commit(uint threads = 0);
+
+    // Statistics of the last successful commit.
+    GMLIB_API OfflineNbtBatchStatistics const& getStatistics() const;
+};
 
 class GMLIB_Player : public Player {
 public:
@@ -12,6 +91,57 @@ public:
 public:
     GMLIB_API static std::vector<std::string> getAllUuids(bool includeOfflineSignedId = false);
 
+    // Threads used by the offline player scans, 0 picks one per core besides the calling thread.
+    GMLIB_API static uint getOfflinePlayerScanThreads(uint threads = 0);
+
+    // The calling thread reads the player records, the visitor decodes them on worker threads.
+    // workerIndex is below getOfflinePlayerScanThreads(threads), so that results can be kept per worker.
+    GMLIB_API static void scanOfflinePlayerRecords(
+        std::function<void(uint workerIndex, std::string_view serverId, std::string_view nbt)> const& visitor,
+        uint                                                                                          threads = 0
+    );
+
+    // Same as scanOfflinePlayerRecords, with the records parsed into tags.
+    GMLIB_API static void scanOfflinePlayerTags(
+        std::function<void(uint workerIndex, std::string const& serverId, CompoundTag& nbt)> const& visitor,
+        uint                                                                                        threads = 0
+    );
+
+    // Runs projection over every stored player on worker threads and returns the results in no particular order.
+    template <typename T>
+    static std::vector<T> scanOfflinePlayers(
+        std::function<std::optional<T>(std::string_view serverId, std::string_view nbt)> const& projection,
+        uint                                                                                    threads = 0
+    ) {
+        std::vector<std::vector<T>> results(getOfflinePlayerScanThreads(threads));
+        scanOfflinePlayerRecords(
+            [&](uint workerIndex, std::string_view serverId, std::string_view nbt) {
+                if (auto result = projection(serverId, nbt)) {
+                    results[workerIndex].push_back(std::move(*result));
+                }
+            },
+            threads
+        );
+        return mergeScanResults(results);
+    }
+
+    template <typename T>
+    static std::vector<T> scanOfflinePlayers(
+        std::function<std::optional<T>(std::string const& serverId, CompoundTag& nbt)> const& projection,
+        uint                                                                                  threads = 0
+    ) {
+        std::vector<std::vector<T>> results(getOfflinePlayerScanThreads(threads));
+        scanOfflinePlayerTags(
+            [&](uint workerIndex, std::string const& serverId, CompoundTag& nbt) {
+                if (auto result = projection(serverId, nbt)) {
+                    results[workerIndex].push_back(std::move(*result));
+                }
+            },
+            threads
+        );
+        return mergeScanResults(results);
+    }
+
     GMLIB_API static std::unique_ptr<CompoundTag> getUuidDBTag(mce::UUID const& uuid);
 
     GMLIB_API static std::string getServerIdFromUuid(mce::UUID const& uuid);
@@ -38,6 +168,31 @@ public:
 
     GMLIB_API static bool deletePlayerNbt(mce::UUID& uuid);
 
+    // Asynchronous counterparts, the DB access and NBT decoding run on GMLIB worker threads.
+    // Callbacks run on the server thread at the end of a level tick, futures are fulfilled on the worker thread.
+    // Requests for the same player run in submission order, queued loads or writes of one player are merged.
+    GMLIB_API static void getOfflineNbtAsync(std::string const& serverId, OfflineNbtCallback callback);
+
+    GMLIB_API static std::future<std::unique_ptr<CompoundTag>> getOfflineNbtAsync(std::string const& serverId);
+
+    // Online players are saved when the callback runs, same as getPlayerNbt.
+    GMLIB_API static void getPlayerNbtAsync(mce::UUID const& uuid, OfflineNbtCallback callback);
+
+    GMLIB_API static void
+    setOfflineNbtAsync(std::string const& serverId, CompoundTag const& nbt, std::function<void(bool)> callback);
+
+    GMLIB_API static std::future<bool> setOfflineNbtAsync(std::string const& serverId, CompoundTag const& nbt);
+
+    GMLIB_API static void deletePlayerNbtAsync(std::string const& serverId, std::function<void(bool)> callback);
+
+    GMLIB_API static std::future<bool> deletePlayerNbtAsync(std::string const& serverId);
+
+    // Requests queued or running.
+    GMLIB_API static size_t getPendingAsyncNbtRequests();
+
+    // Requests answered by an earlier queued request of the same player.
+    GMLIB_API static size_t getMergedAsyncNbtRequests();
+
     GMLIB_API static std::optional<int> getPlayerScore(std::string& serverId, std::string objective);
 
     GMLIB_API static std::optional<int> getPlayerScore(mce::UUID& uuid, std::string objective);
@@ -64,6 +219,19 @@ public:
 
     GMLIB_API static bool resetPlayerScore(mce::UUID& uuid);
 
+    GMLIB_API static SidebarStatistics getSidebarStatistics();
+
+    GMLIB_API static void resetSidebarStatistics();
+
+    // Bossbar updates of a player are sent at most once per this many ticks, the latest value wins.
+    GMLIB_API static void setBossbarUpdateInterval(uint ticks = 1);
+
+    GMLIB_API static uint getBossbarUpdateInterval();
+
+    GMLIB_API static PacketQueueStatistics getPacketQueueStatistics();
+
+    GMLIB_API static void resetPacketQueueStatistics();
+
 public:
     GMLIB_API std::unique_ptr<CompoundTag> getNbt();
 
@@ -80,7 +248,15 @@ public:
 
     GMLIB_API bool resetScore();
 
+    // Packets GMLIB sends to this player (sidebar, bossbar, weather, floating text, fake list) are held until the end
+    // of the tick, a later sidebar, bossbar, weather or floating text update replaces an earlier one still queued.
+    // Disabling sends what is queued.
+    GMLIB_API void setPacketQueueEnabled(bool enabled = true);
+
+    GMLIB_API bool isPacketQueueEnabled();
 
+
+    // Sent at the end of the tick, only the lines changed since the last sent sidebar are updated.
     GMLIB_API void setClientSidebar(
         const std::string                               title,
         const std::vector<std::pair<std::string, int>>& data,
@@ -113,6 +289,7 @@ public:
 
     GMLIB_API void setClientGamemode(GameType gamemode);
 
+    // Sent at the end of the tick, a shown bossbar only gets the BossEvent updates of the changed fields.
     GMLIB_API void setClientBossbar(
         int64_t        bossbarId,
         std::string    name,
@@ -162,4 +339,19 @@ public:
     // GMLIB_API int clearItem(std::string name, int count = 1, short aux = -1);
 
     // GMLIB_API int hasItem(std::string name, short aux = -1);
+
+private:
+    template <typename T>
+    static std::vector<T> mergeScanResults(std::vector<std::vector<T>>& results) {
+        size_t size = 0;
+        for (auto& result : results) {
+            size += result.size();
+        }
+        std::vector<T> merged;
+        merged.reserve(size);
+        for (auto& result : results) {
+            std::move(result.begin(), result.end(), std::back_inserter(merged));
+        }
+        return merged;
+    }
 };
\ No newline at end of file
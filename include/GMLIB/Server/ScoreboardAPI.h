@@ -1,6 +1,24 @@
 #pragma once
 #include "GMLIB/GMLIB.h"
 
+struct ScoreCacheStatistics {
+    uint64_t mHits          = 0;
+    uint64_t mMisses        = 0;
+    uint64_t mInvalidations = 0; // Cached scores dropped for a change of the score or its objective
+    size_t   mEntries       = 0;
+};
+
+struct ScoreChange {
+    ScoreboardId           mId;
+    int                    mValue;
+    PlayerScoreSetFunction mAction = PlayerScoreSetFunction::Set;
+};
+
+struct LeaderboardEntry {
+    ScoreboardId mId;
+    int          mScore;
+};
+
 class GMLIB_Scoreboard : public Scoreboard {
 public:
     using Scoreboard::addObjective;
@@ -14,6 +32,10 @@ public:
 
     GMLIB_API static bool setObjectiveDisplayName(std::string objective, std::string newName);
 
+    GMLIB_API static ScoreCacheStatistics getScoreCacheStatistics();
+
+    GMLIB_API static void resetScoreCacheStatistics();
+
 public:
     GMLIB_API Objective* addObjective(std::string name);
 
@@ -25,6 +47,7 @@ public:
 
     GMLIB_API ScoreboardId getPlayerScoreboardId(mce::UUID& uuid);
 
+    // Served from a cache kept up to date by hooks on score changes and resets.
     GMLIB_API std::optional<int> getScore(Objective* objective, ScoreboardId& scoreboardId);
 
     GMLIB_API std::optional<int> getScore(std::string objective, std::string name);
@@ -56,6 +79,10 @@ public:
     GMLIB_API std::optional<int>
     setScore(std::string objective, Player* pl, int value, PlayerScoreSetFunction action = PlayerScoreSetFunction::Set);
 
+    // Applies every change to the objective, created if missing, which is looked up once. Clients get a single score
+    // packet with the final score of each changed id. The results are in the order of changes.
+    GMLIB_API std::vector<std::optional<int>> setScores(std::string objective, std::vector<ScoreChange> const& changes);
+
     GMLIB_API std::optional<int>
     setScore(std::string objective, Actor* ac, int value, PlayerScoreSetFunction action = PlayerScoreSetFunction::Set);
 
@@ -109,4 +136,34 @@ public:
     GMLIB_API bool resetPlayerAllScores(Player* pl);
 
     GMLIB_API std::vector<ScoreboardId> getAllScoreboardIds();
+
+    // Streams every objective, identity and score to a binary snapshot.
+    GMLIB_API bool exportScores(std::string const& path);
+
+    // Creates missing objectives and sets the scores of the snapshot through setScores. Fake players are created,
+    // players this scoreboard has never tracked and entities are skipped. Scores are read in blocks, but the id of
+    // every identity in the snapshot is kept until the import ends.
+    GMLIB_API bool importScores(std::string const& path);
+
+    // Keeps the scores of an existing objective in order, updated on every score change. Removing the objective
+    // removes its leaderboard.
+    GMLIB_API bool
+    registerLeaderboard(std::string objective, ObjectiveSortOrder sortOrder = ObjectiveSortOrder::Descending);
+
+    GMLIB_API bool unregisterLeaderboard(std::string objective);
+
+    GMLIB_API bool hasLeaderboard(std::string objective);
+
+    GMLIB_API size_t getLeaderboardSize(std::string objective);
+
+    GMLIB_API std::vector<LeaderboardEntry> getLeaderboardTop(std::string objective, size_t count);
+
+    GMLIB_API std::vector<LeaderboardEntry> getLeaderboardRange(std::string objective, size_t offset, size_t count);
+
+    // Entries with minScore <= score <= maxScore in leaderboard order.
+    GMLIB_API std::vector<LeaderboardEntry>
+    getLeaderboardScoreRange(std::string objective, int minScore, int maxScore, size_t limit = SIZE_MAX);
+
+    // 0 is the first place.
+    GMLIB_API std::optional<size_t> getLeaderboardRank(std::string objective, ScoreboardId& scoreboardId);
 };
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+#include "GMLIB/GMLIB.h"
+#include "GMLIB/Server/PlayerAPI.h"
+
+// A sidebar shown to a group of players. Each update is encoded once, and the same packets go to every subscriber.
+class SidebarChannel {
+public:
+    virtual ~SidebarChannel() = default;
+
+    // A player is in at most one channel, GMLIB_Player::setClientSidebar and removeClientSidebar leave it.
+    virtual void subscribe(Player& player) = 0;
+
+    // Hides the sidebar of the player.
+    virtual void unsubscribe(Player& player) = 0;
+
+    virtual bool isSubscribed(Player& player) const = 0;
+
+    virtual size_t getSubscriberCount() const = 0;
+
+    // Sent at the end of the tick, only the lines changed since the last update are sent.
+    virtual void setSidebar(
+        std::string const&                              title,
+        std::vector<std::pair<std::string, int>> const& data,
+        ObjectiveSortOrder                              sortOrder = ObjectiveSortOrder::Ascending
+    ) = 0;
+
+    // Shows the line with the text lineText as text and score to one player, the other lines stay shared.
+    virtual void setPlayerLine(Player& player, std::string const& lineText, std::string const& text, int score) = 0;
+
+    virtual void resetPlayerLine(Player& player, std::string const& lineText) = 0;
+
+    virtual void resetPlayerLines(Player& player) = 0;
+
+public:
+    GMLIB_API static std::shared_ptr<SidebarChannel> create();
+};
@@ -4,12 +4,26 @@
 
 namespace GMLIB::Server::UserCache {
 
+struct UserCacheInfo {
+    std::string mUuid;
+    std::string mXuid;
+    std::string mRealName;
+};
+
 GMLIB_API std::optional<nlohmann::json> tryFindCahceInfoFromUuid(std::string& uuid);
 
 GMLIB_API std::optional<nlohmann::json> tryFindCahceInfoFromXuid(std::string& xuid);
 
 GMLIB_API std::optional<nlohmann::json> tryFindCahceInfoFromName(std::string& name);
 
+GMLIB_API std::optional<UserCacheInfo> tryFindCacheInfoByUuid(std::string_view uuid);
+
+GMLIB_API std::optional<UserCacheInfo> tryFindCacheInfoByXuid(std::string_view xuid);
+
+GMLIB_API std::optional<UserCacheInfo> tryFindCacheInfoByName(std::string_view name);
+
+GMLIB_API size_t getUserCacheSize();
+
 GMLIB_API std::optional<std::string> getXuidByUuid(std::string& uuid);
 
 GMLIB_API std::optional<std::string> getNameByUuid(std::string& uuid);
@@ -22,4 +36,23 @@ GMLIB_API std::optional<std::string> getXuidByName(std::string& name);
 
 GMLIB_API std::optional<std::string> getUuidByName(std::string& name);
 
+// Case insensitive, ordered by name.
+GMLIB_API std::vector<UserCacheInfo> searchUserCacheByNamePrefix(std::string_view prefix, size_t limit = 10);
+
+// Case insensitive and typo tolerant (at most one typo per four letters), the best matches first.
+GMLIB_API std::vector<UserCacheInfo>
+searchUserCacheByName(std::string_view name, size_t limit = 10, size_t maxDistance = 2);
+
+// Writes the whole cache in the usercache.json layout.
+GMLIB_API bool exportUserCacheToJson(std::string const& path);
+
+// Merges a file in the usercache.json layout into the cache, the records can be looked up once it returns.
+GMLIB_API bool importUserCacheFromJson(std::string const& path);
+
+// Switches the on-disk format between usercache.json and the memory mapped usercache.bin.
+// Takes effect at the next compaction, at the latest when the server stops.
+GMLIB_API void setUserCacheBinaryFormat(bool value = true);
+
+GMLIB_API bool isUserCacheBinaryFormat();
+
 } // namespace GMLIB::Server
\ No newline at end of file
@@ -27,12 +27,13 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     class Vec3&        pos,
     int                throwTime
 ) {
+    GMLIB_PROFILE_HOOK(ItemSpawnEventHook);
     auto beforeEvent = ItemActorSpawnBeforeEvent(region, pos, item, spawner, throwTime);
     ll::event::EventBus::getInstance().publish(beforeEvent);
     if (beforeEvent.isCancelled()) {
         return nullptr;
     }
-    auto result = origin(region, item, spawner, pos, throwTime);
+    auto result = GMLIB_PROFILE_ORIGIN(origin(region, item, spawner, pos, throwTime));
     if (result) {
         auto afterEvent = ItemActorSpawnAfterEvent(*result, region, pos, item, spawner, throwTime);
         ll::event::EventBus::getInstance().publish(afterEvent);
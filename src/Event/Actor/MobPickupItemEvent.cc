@@ -15,13 +15,14 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     void,
     class ItemActor& item
 ) {
+    GMLIB_PROFILE_HOOK(MobPickupItemEventHook);
     auto mob         = ll::memory::dAccess<Mob*>(this, 112); // IDA: PickupItemsGoal::PickupItemsGoal()
     auto beforeEvent = MobPickupItemBeforeEvent(*mob, item);
     ll::event::EventBus::getInstance().publish(beforeEvent);
     if (beforeEvent.isCancelled()) {
         return;
     }
-    origin(item);
+    GMLIB_PROFILE_ORIGIN(origin(item));
     auto afterEvent = MobPickupItemAfterEvent(*mob, item);
     ll::event::EventBus::getInstance().publish(afterEvent);
 }
@@ -24,13 +24,14 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     float lightningLevel,
     int   lightningTime
 ) {
+    GMLIB_PROFILE_HOOK(WeatherUpdateEventHook);
     WeatherUpdateBeforeEvent beforeEvent =
         WeatherUpdateBeforeEvent(*this, rainLevel, rainTime, lightningLevel, lightningTime);
     ll::event::EventBus::getInstance().publish(beforeEvent);
     if (beforeEvent.isCancelled()) {
         return;
     }
-    origin(rainLevel, rainTime, lightningLevel, lightningTime);
+    GMLIB_PROFILE_ORIGIN(origin(rainLevel, rainTime, lightningLevel, lightningTime));
     WeatherUpdateAfterEvent afterEvent =
         WeatherUpdateAfterEvent(*this, rainLevel, rainTime, lightningLevel, lightningTime);
     ll::event::EventBus::getInstance().publish(afterEvent);
@@ -23,12 +23,13 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     int,
     BlockPos& pos
 ) {
+    GMLIB_PROFILE_HOOK(PlayerStartSleepEventHook);
     PlayerStartSleepBeforeEvent beforeEvent = PlayerStartSleepBeforeEvent(*this, pos);
     ll::event::EventBus::getInstance().publish(beforeEvent);
     if (beforeEvent.isCancelled()) {
         return 1;
     }
-    auto                       res        = origin(pos);
+    auto                       res        = GMLIB_PROFILE_ORIGIN(origin(pos));
     PlayerStartSleepAfterEvent afterEvent = PlayerStartSleepAfterEvent(*this, pos, res);
     ll::event::EventBus::getInstance().publish(afterEvent);
     return res;
@@ -42,12 +43,13 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     void,
     bool forcefulWakeUp, bool updateLevelList
 ) {
+    GMLIB_PROFILE_HOOK(PlayerStopSleepEventHook);
     PlayerStopSleepBeforeEvent beforeEvent = PlayerStopSleepBeforeEvent(*this, forcefulWakeUp, updateLevelList);
     ll::event::EventBus::getInstance().publish(beforeEvent);
     if (beforeEvent.isCancelled()) {
         return;
     }
-    origin(forcefulWakeUp, updateLevelList);
+    GMLIB_PROFILE_ORIGIN(origin(forcefulWakeUp, updateLevelList));
     PlayerStopSleepAfterEvent afterEvent = PlayerStopSleepAfterEvent(*this, forcefulWakeUp, updateLevelList);
     ll::event::EventBus::getInstance().publish(afterEvent);
 }
@@ -36,10 +36,19 @@ void loadLib() {
 
 void enableLib() { 
     initExperiments(&ll::service::bedrock::getLevel()->getLevelData());
+    GMLIB::PlayerAPI::initPlayerIdIndex();
+    GMLIB::PlayerAPI::initAsyncNbt();
+    GMLIB::PlayerAPI::initSidebars();
+    GMLIB::PlayerAPI::initBossbars();
+    GMLIB::PlayerAPI::initPacketQueues();
     CaculateTPS(); 
 }
 
-void disableLib() {}
+void disableLib() {
+    GMLIB::PlayerAPI::stopAsyncNbt();
+    GMLIB::PlayerAPI::savePlayerIdIndex();
+    GMLIB::Server::UserCache::flushUserCache();
+}
 
 namespace Version {
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "Plugin.h"
+#include "Server/HookProfiler/HookProfiler.h"
 #include "include_all.h"
 
 extern ll::Logger logger;
@@ -11,8 +12,25 @@ class DBStorage;
 
 namespace GMLIB::Server::UserCache {
 extern void initUserCache();
+extern void flushUserCache();
+extern void publishUserCache(bool wait = false);
 } // namespace GMLIB::Server::UserCache
 
+namespace GMLIB::PlayerAPI {
+extern void initPlayerIdIndex();
+extern void savePlayerIdIndex();
+extern void processPlayerIdIndex();
+extern void initAsyncNbt();
+extern void processAsyncNbt();
+extern void stopAsyncNbt();
+extern void initSidebars();
+extern void processSidebars();
+extern void initBossbars();
+extern void processBossbars();
+extern void initPacketQueues();
+extern void processPacketQueues();
+} // namespace GMLIB::PlayerAPI
+
 namespace GMLIB {
 
 template <typename T>
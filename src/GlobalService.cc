@@ -9,7 +9,8 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     struct DBStorageConfig&                        a1,
     Bedrock::NotNullNonOwnerPtr<class LevelDbEnv>& a2
 ) {
-    auto res                 = origin(a1, a2);
+    GMLIB_PROFILE_HOOK(DBStorageInitEvent);
+    auto res                 = GMLIB_PROFILE_ORIGIN(origin(a1, a2));
     GMLIB::Global<DBStorage> = this;
     return res;
 }
\ No newline at end of file
@@ -32,7 +32,8 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     ResourcePack*,
     Pack* a1
 ) {
-    auto pack     = origin(a1);
+    GMLIB_PROFILE_HOOK(PacksBuildEvent);
+    auto pack     = GMLIB_PROFILE_ORIGIN(origin(a1));
     auto manifest = &pack->getManifest();
     if (manifest && manifest->getPackOrigin() == PackOrigin::Test) {
         mPackListCache.push_back(a1->getManifest().getIdentity().asString());
@@ -51,7 +52,8 @@ LL_AUTO_STATIC_HOOK(
     std::istream&                                                                 a1,
     gsl::not_null<Bedrock::NonOwnerPointer<IResourcePackRepository const>> const& a2
 ) {
-    auto stack = origin(a1, a2);
+    GMLIB_PROFILE_HOOK(PacksLoadEvent);
+    auto stack = GMLIB_PROFILE_ORIGIN(origin(a1, a2));
     for (auto id : mPackListCache) {
         auto  pack = ll::service::getResourcePackRepository()->getResourcePackForPackId(PackIdVersion::fromString(id));
         auto& SettingsFactory = ll::service::getResourcePackRepository()->getPackSettingsFactory();
@@ -79,9 +81,10 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     "?_initialize@ResourcePackRepository@@AEAAXXZ",
     void
 ) {
+    GMLIB_PROFILE_HOOK(ResourcePackRepositoryInitEvent);
     addResourcePackPath(this, PackType::Behavior);
     addResourcePackPath(this, PackType::Resources);
-    return origin();
+    return GMLIB_PROFILE_ORIGIN(origin());
 }
 
 } // namespace GMLIB::Mod
\ No newline at end of file
@@ -40,7 +40,8 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     std::vector<BiomeNoiseTarget>* a1,
     BiomeRegistry*                 a2
 ) {
-    origin(a1, a2);
+    GMLIB_PROFILE_HOOK(OverworldBiomeBuilderHook);
+    GMLIB_PROFILE_ORIGIN(origin(a1, a2));
     if (mCustomBiomeEnabled) {
         for (auto& [name, data] : mClimates) {
             if (data.mType == BiomeType::Surface) {
@@ -84,19 +85,21 @@ LL_AUTO_STATIC_HOOK(
     void*          a3,
     void*          a4
 ) {
+    GMLIB_PROFILE_HOOK(BiomeRegistryHook);
     if (mCustomBiomeEnabled) {
         for (auto& name : mNewBiomes) {
             a1->registerBiome(name);
         }
     }
-    return origin(a1, a2, a3, a4);
+    return GMLIB_PROFILE_ORIGIN(origin(a1, a2, a3, a4));
 }
 
 LL_AUTO_INSTANCE_HOOK(ClientGen, HookPriority::Highest, "?isClientSideGenEnabled@PropertiesSettings@@QEBA_NXZ", bool) {
+    GMLIB_PROFILE_HOOK(ClientGen);
     if (mCustomBiomeEnabled) {
         return false;
     }
-    return origin();
+    return GMLIB_PROFILE_ORIGIN(origin());
 }
 
 }
\ No newline at end of file
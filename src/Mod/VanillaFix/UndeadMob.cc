@@ -8,7 +8,8 @@ bool mEnableUndeadFix = false;
 void VanillaFix::setFixCustomUndeadMobs(bool value) { mEnableUndeadFix = value; }
 
 LL_AUTO_TYPE_INSTANCE_HOOK(UndeadMobFix, HookPriority::Highest, Actor, "?isInvertedHealAndHarm@Actor@@QEBA_NXZ", bool) {
-    return mEnableUndeadFix ? this->hasFamily("undead") : origin();
+    GMLIB_PROFILE_HOOK(UndeadMobFix);
+    return mEnableUndeadFix ? this->hasFamily("undead") : GMLIB_PROFILE_ORIGIN(origin());
 }
 
 } // namespace GMLIB::Mod
\ No newline at end of file
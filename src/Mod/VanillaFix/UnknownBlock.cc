@@ -55,8 +55,9 @@ LL_AUTO_INSTANCE_HOOK(
     int          a2,
     void*        a3
 ) {
+    GMLIB_PROFILE_HOOK(LoadUnknownBlock);
     mUnknownBlockLegacyNameList.insert(a1);
-    return origin(a1, a2, a3);
+    return GMLIB_PROFILE_ORIGIN(origin(a1, a2, a3));
 }
 
 LL_AUTO_TYPE_INSTANCE_HOOK(
@@ -66,6 +67,7 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     "?_setOnChunkLoadedCalled@LevelChunk@@QEAA_NXZ",
     bool
 ) {
+    GMLIB_PROFILE_HOOK(ChunkLoadEvent);
     if (mAutoCleanUnknownBlockEnabled) {
         auto cp    = this->getPosition();
         auto dimid = this->getDimension().getDimensionId();
@@ -73,7 +75,7 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
             setChunkFixed(cp, dimid);
         }
     }
-    return origin();
+    return GMLIB_PROFILE_ORIGIN(origin());
 }
 
 } // namespace GMLIB::Mod
\ No newline at end of file
@@ -17,6 +17,7 @@ bool Plugin::enable() {
 bool Plugin::disable() {
     logger.info("Disabling GMLIB...");
     // Code for disabling the plugin goes here.
+    GMLIB::disableLib();
     logger.info("GMLIB Disabled!");
     return true;
 }
@@ -60,7 +60,7 @@ inline void GMLIB_BinaryStream::writePropertySyncData(struct PropertySyncData co
         writeVarInt(IntEntry.mData);
     }
     writeUnsignedVarInt(syncdata.mFloatEntries.size());
-    for (auto FloatEntry : syncdata.mIntEntries) {
+    for (auto FloatEntry : syncdata.mFloatEntries) {
         writeUnsignedVarInt(FloatEntry.mPropertyIndex);
         writeFloat(FloatEntry.mData);
     }
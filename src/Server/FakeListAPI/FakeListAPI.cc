@@ -1,4 +1,5 @@
 #include "Server/FakeListAPI/FakeListAPI.h"
+#include "Server/PlayerAPI/PacketQueueAPI.h"
 #include <GMLIB/Server/FakeListAPI.h>
 
 namespace GMLIB::Server {
@@ -7,7 +8,7 @@ inline void sendAddFakeListPacket(PlayerListEntry entry) {
     auto pkt    = PlayerListPacket();
     pkt.mAction = PlayerListPacketType::Add;
     pkt.emplace(std::move(entry));
-    pkt.sendToClients();
+    GMLIB::PlayerAPI::sendAllPlayersPacket(pkt);
 }
 
 inline void sendRemoveFakeListPacket(std::vector<PlayerListEntry> entries) {
@@ -16,7 +17,7 @@ inline void sendRemoveFakeListPacket(std::vector<PlayerListEntry> entries) {
     for (auto& entry : entries) {
         pkt.emplace(std::move(entry));
     }
-    pkt.sendToClients();
+    GMLIB::PlayerAPI::sendAllPlayersPacket(pkt);
 }
 
 bool FakeList::addFakeList(PlayerListEntry entry) {
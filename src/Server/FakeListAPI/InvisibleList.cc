@@ -17,6 +17,7 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     "?setLocalPlayerAsInitialized@ServerPlayer@@QEAAXXZ",
     bool
 ) {
+    GMLIB_PROFILE_HOOK(sendAllFakeListPlayerJoin);
     auto pkt    = PlayerListPacket();
     pkt.mAction = PlayerListPacketType::Add;
     for (auto fakeListPair : GMLIB::FakeListAPI::mFakeListMap) {
@@ -31,7 +32,7 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     ablitiespkt->read(bs);
     pkt.sendToClients();
     ablitiespkt->sendToClients();
-    return origin();
+    return GMLIB_PROFILE_ORIGIN(origin());
 }
 
 LL_AUTO_TYPE_INSTANCE_HOOK(
@@ -42,6 +43,7 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     void,
     PlayerListEntry& entry
 ) {
+    GMLIB_PROFILE_HOOK(fakeListEmplace);
     if (this->mAction == PlayerListPacketType::Add) {
         if (GMLIB::FakeListAPI::mInvisibleMap.count(entry.mName)) {
             return;
@@ -56,7 +58,7 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
             entry.mName = GMLIB::FakeListAPI::mReplaceMap[entry.mName];
         }
     }
-    return origin(entry);
+    return GMLIB_PROFILE_ORIGIN(origin(entry));
 }
 
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Global.h"
+#include "Server/PlayerAPI/PacketQueueAPI.h"
 #include "mc/world/item/NetworkItemStackDescriptor.h"
 #include <GMLIB/Server/ActorAPI.h>
 #include <GMLIB/Server/BinaryStreamAPI.h>
@@ -22,7 +23,7 @@ FloatingText::~FloatingText() {
 
 int64_t FloatingText::getFloatingTextRuntimeId() { return mRuntimeId; }
 
-GMLIB_NetworkPacket<15> createFloatingTextPacket(FloatingText* ft) {
+std::string createFloatingTextPacket(FloatingText* ft) {
     auto               item = std::make_unique<ItemStack>(ItemStack{"minecraft:air"});
     auto               nisd = NetworkItemStackDescriptor(*item);
     GMLIB_BinaryStream bs;
@@ -40,32 +41,48 @@ GMLIB_NetworkPacket<15> createFloatingTextPacket(FloatingText* ft) {
     bs.writeUnsignedVarInt((uint)0x0);
     bs.writeBool(true);
     bs.writeBool(false);
-    GMLIB_NetworkPacket<(int)MinecraftPacketIds::AddItemActor> pkt(bs.getAndReleaseData());
-    return pkt;
+    return bs.getAndReleaseData();
+}
+
+// Adds and removes have their own keys, a later add only replaces a queued add and a later remove a queued remove.
+// The replacing packet moves behind everything queued, so a remove followed by an add, as a text refresh does, still
+// sends both and the last call of the tick wins.
+std::string getFloatingTextKey(FloatingText* ft, bool remove) {
+    return (remove ? "floatingtext:remove:" : "floatingtext:add:") + std::to_string(ft->mRuntimeId);
+}
+
+void sendFloatingTextPacket(FloatingText* ft, Player& pl, std::string const& data) {
+    GMLIB::PlayerAPI::sendPlayerPacket(pl, (int)MinecraftPacketIds::AddItemActor, data, getFloatingTextKey(ft, false));
 }
 
 void FloatingText::sendToClient(Player* pl) {
     if (!pl->isSimulatedPlayer() && pl->getDimensionId() == mDimensionId) {
-        auto pkt = createFloatingTextPacket(this);
-        pkt.sendTo(*pl);
+        sendFloatingTextPacket(this, *pl, createFloatingTextPacket(this));
     }
 }
 
 void FloatingText::sendToAllClients() {
-    auto pkt = createFloatingTextPacket(this);
+    auto data = createFloatingTextPacket(this);
     ll::service::getLevel()->forEachPlayer([&](Player& pl) -> bool {
         if (!pl.isSimulatedPlayer() && pl.getDimensionId() == mDimensionId) {
-            pkt.sendTo(pl);
+            sendFloatingTextPacket(this, pl, data);
         }
         return true;
     });
 }
 
-void FloatingText::removeFromAllClients() { RemoveActorPacket(ActorUniqueID(this->mRuntimeId)).sendToClients(); }
+void FloatingText::removeFromAllClients() {
+    auto pkt = RemoveActorPacket(ActorUniqueID(this->mRuntimeId));
+    GMLIB::PlayerAPI::sendAllPlayersPacket(pkt, getFloatingTextKey(this, true));
+}
 
 void FloatingText::removeFromClient(Player* pl) {
     if (!pl->isSimulatedPlayer()) {
-        RemoveActorPacket(ActorUniqueID(this->mRuntimeId)).sendTo(*pl);
+        GMLIB::PlayerAPI::sendPlayerPacket(
+            *pl,
+            RemoveActorPacket(ActorUniqueID(this->mRuntimeId)),
+            getFloatingTextKey(this, true)
+        );
     }
 }
 
@@ -114,7 +114,7 @@ void NpcDialogueForm::sendTo(
 }
 
 LL_AUTO_TYPE_INSTANCE_HOOK(
-    Test3,
+    NpcRequestPacketHook,
     ll::memory::HookPriority::Normal,
     ServerNetworkHandler,
     "?handle@ServerNetworkHandler@@UEAAXAEBVNetworkIdentifier@@AEBVNpcRequestPacket@@@Z",
@@ -122,6 +122,7 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     class NetworkIdentifier const& source,
     class NpcRequestPacket const&  packet
 ) {
+    GMLIB_PROFILE_HOOK(NpcRequestPacketHook);
     auto runtimeId = packet.mId.id;
     if (mRuntimeNpcFormList.count(runtimeId)) {
         auto pl = (Player*)this->getServerPlayer(source, packet.mClientSubId).as_ptr();
@@ -137,7 +138,7 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
             }
         }
     }
-    return origin(source, packet);
+    return GMLIB_PROFILE_ORIGIN(origin(source, packet));
 }
 
 }
\ No newline at end of file
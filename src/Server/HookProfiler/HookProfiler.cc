@@ -0,0 +1,69 @@
+#include "Global.h"
+#include <GMLIB/Server/HookProfiler.h>
+
+namespace GMLIB::HookProfilerAPI {
+
+GMLIB::Server::HookProfiler::HookStatistics getSiteStatistics(HookSite const& site) {
+    GMLIB::Server::HookProfiler::HookStatistics result;
+    result.mName      = site.mName;
+    result.mCalls     = site.mCalls;
+    result.mTotalTime = site.mTotalTime;
+    result.mMaxTime   = site.mMaxTime;
+    for (auto& count : site.mHistogram) {
+        result.mHistogram.push_back(count);
+    }
+    return result;
+}
+
+} // namespace GMLIB::HookProfilerAPI
+
+namespace GMLIB::Server::HookProfiler {
+
+void setEnabled(bool enabled) { GMLIB::HookProfilerAPI::mEnabled = enabled; }
+
+bool isEnabled() { return GMLIB::HookProfilerAPI::mEnabled; }
+
+void resetStatistics() {
+    GMLIB::HookProfilerAPI::forEachSite([](GMLIB::HookProfilerAPI::HookSite& site) { site.reset(); });
+}
+
+std::optional<HookStatistics> getStatistics(std::string const& hookName) {
+    if (auto site = GMLIB::HookProfilerAPI::findSite(hookName)) {
+        return GMLIB::HookProfilerAPI::getSiteStatistics(*site);
+    }
+    return {};
+}
+
+std::vector<HookStatistics> getAllStatistics() {
+    std::vector<HookStatistics> result;
+    GMLIB::HookProfilerAPI::forEachSite([&](GMLIB::HookProfilerAPI::HookSite& site) {
+        result.push_back(GMLIB::HookProfilerAPI::getSiteStatistics(site));
+    });
+    return result;
+}
+
+nlohmann::json dumpJson() {
+    auto result       = nlohmann::json::object();
+    result["enabled"] = isEnabled();
+    auto hooks        = nlohmann::json::object();
+    for (auto& stats : getAllStatistics()) {
+        auto info         = nlohmann::json::object();
+        info["calls"]     = stats.mCalls;
+        info["totalTime"] = stats.mTotalTime;
+        info["maxTime"]   = stats.mMaxTime;
+        info["avgTime"]   = stats.mCalls ? stats.mTotalTime / stats.mCalls : 0;
+        // Only the non empty buckets, keyed by their upper bound in nanoseconds
+        auto histogram = nlohmann::json::object();
+        for (size_t i = 0; i < stats.mHistogram.size(); i++) {
+            if (stats.mHistogram[i]) {
+                histogram[std::to_string(1ull << i)] = stats.mHistogram[i];
+            }
+        }
+        info["histogram"]  = histogram;
+        hooks[stats.mName] = info;
+    }
+    result["hooks"] = hooks;
+    return result;
+}
+
+} // namespace GMLIB::Server::HookProfiler
@@ -0,0 +1,92 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+
+// Usage in a hook body:
+//     GMLIB_PROFILE_HOOK(HookName);
+//     auto result = GMLIB_PROFILE_ORIGIN(origin(args...));
+// Time spent in the original function is excluded, only the GMLIB part of the hook is recorded.
+#define GMLIB_PROFILE_HOOK(name)                                                                                       \
+    static auto& gmlibHookSite = GMLIB::HookProfilerAPI::registerSite(#name);                                        \
+    GMLIB::HookProfilerAPI::ScopedHookTimer gmlibHookTimer(gmlibHookSite)
+
+#define GMLIB_PROFILE_ORIGIN(...) gmlibHookTimer.exclude([&]() -> decltype(auto) { return __VA_ARGS__; })
+
+namespace GMLIB::HookProfilerAPI {
+
+constexpr size_t HISTOGRAM_BUCKETS = 40;
+
+struct HookSite {
+    std::string                                          mName;
+    std::atomic<uint64_t>                                mCalls     = 0;
+    std::atomic<uint64_t>                                mTotalTime = 0;
+    std::atomic<uint64_t>                                mMaxTime   = 0;
+    std::array<std::atomic<uint64_t>, HISTOGRAM_BUCKETS> mHistogram = {};
+
+    explicit HookSite(std::string name) : mName(std::move(name)) {}
+
+    void record(uint64_t time);
+
+    void reset();
+};
+
+inline std::atomic<bool> mEnabled = false;
+
+extern HookSite& registerSite(std::string name);
+
+// Sites are never removed, the returned pointer stays valid.
+extern HookSite* findSite(std::string const& name);
+
+// In registration order.
+extern void forEachSite(std::function<void(HookSite& site)> const& callback);
+
+class ScopedHookTimer {
+    using clock = std::chrono::steady_clock;
+
+    HookSite*         mSite; // nullptr while profiling is disabled
+    clock::time_point mStart;
+    clock::duration   mExcluded = {};
+
+    struct ExcludeGuard {
+        ScopedHookTimer&  mTimer;
+        clock::time_point mBegin;
+
+        explicit ExcludeGuard(ScopedHookTimer& timer)
+        : mTimer(timer),
+          mBegin(timer.mSite ? clock::now() : clock::time_point{}) {}
+
+        ~ExcludeGuard() {
+            if (mTimer.mSite) {
+                mTimer.mExcluded += clock::now() - mBegin;
+            }
+        }
+    };
+
+public:
+    explicit ScopedHookTimer(HookSite& site) : mSite(mEnabled.load(std::memory_order_relaxed) ? &site : nullptr) {
+        if (mSite) {
+            mStart = clock::now();
+        }
+    }
+
+    ScopedHookTimer(ScopedHookTimer const&)            = delete;
+    ScopedHookTimer& operator=(ScopedHookTimer const&) = delete;
+
+    ~ScopedHookTimer() {
+        if (mSite) {
+            auto elapsed = clock::now() - mStart - mExcluded;
+            mSite->record(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+    }
+
+    template <typename Fn>
+    decltype(auto) exclude(Fn&& fn) {
+        ExcludeGuard guard(*this);
+        return std::forward<Fn>(fn)();
+    }
+};
+
+} // namespace GMLIB::HookProfilerAPI
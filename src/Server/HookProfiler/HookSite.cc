@@ -0,0 +1,56 @@
+#include "Server/HookProfiler/HookProfiler.h"
+#include <algorithm>
+#include <bit>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+// Engine independent part of the profiler, the timers and the site registry.
+namespace GMLIB::HookProfilerAPI {
+
+std::mutex                                 mSiteMutex;
+std::deque<HookSite>                       mSites;
+std::unordered_map<std::string, HookSite*> mSiteMap;
+
+void HookSite::record(uint64_t time) {
+    mCalls.fetch_add(1, std::memory_order_relaxed);
+    mTotalTime.fetch_add(time, std::memory_order_relaxed);
+    auto max = mMaxTime.load(std::memory_order_relaxed);
+    while (time > max && !mMaxTime.compare_exchange_weak(max, time, std::memory_order_relaxed)) {}
+    auto bucket = std::min<size_t>(std::bit_width(time), HISTOGRAM_BUCKETS - 1);
+    mHistogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void HookSite::reset() {
+    mCalls     = 0;
+    mTotalTime = 0;
+    mMaxTime   = 0;
+    for (auto& count : mHistogram) {
+        count = 0;
+    }
+}
+
+HookSite& registerSite(std::string name) {
+    std::lock_guard lock(mSiteMutex);
+    if (mSiteMap.count(name)) {
+        return *mSiteMap[name];
+    }
+    auto& site     = mSites.emplace_back(name);
+    mSiteMap[name] = &site;
+    return site;
+}
+
+HookSite* findSite(std::string const& name) {
+    std::lock_guard lock(mSiteMutex);
+    auto            it = mSiteMap.find(name);
+    return it != mSiteMap.end() ? it->second : nullptr;
+}
+
+void forEachSite(std::function<void(HookSite& site)> const& callback) {
+    std::lock_guard lock(mSiteMutex);
+    for (auto& site : mSites) {
+        callback(site);
+    }
+}
+
+} // namespace GMLIB::HookProfilerAPI
@@ -0,0 +1,203 @@
+#include "Server/LevelAPI/FillEngine.h"
+#include <GMLIB/Server/BinaryStreamAPI.h>
+#include <GMLIB/Server/NetworkPacketAPI.h>
+
+namespace GMLIB::LevelAPI {
+
+// Blocks are written without network sync, the whole tile is synced by one packet instead.
+constexpr int FILL_UPDATE_FLAGS    = 1; // Neighbors
+constexpr int NO_UPDATE_FLAGS      = 0;
+constexpr int CLIENT_UPDATE_FLAGS  = 2; // Network
+constexpr int SUBCHUNK_SIZE        = 16;
+constexpr int UPDATE_SUBCHUNK_PKID = 172; // UpdateSubChunkBlocksPacket
+
+bool mFillNeighbourUpdates = true;
+
+inline int alignToSubChunk(int value) { return value & ~(SUBCHUNK_SIZE - 1); }
+
+bool checkFillPos(BlockPos startpos, BlockPos endpos) {
+    if (startpos.x <= endpos.x && startpos.y <= endpos.y && startpos.z <= endpos.z) {
+        return true;
+    }
+    return false;
+}
+
+bool checkPosInRange(BlockPos pos, BlockPos startpos, BlockPos endpos) {
+    if (pos.x > startpos.x && pos.y > startpos.y && pos.z > startpos.z && pos.x < endpos.x && pos.y < endpos.y
+        && pos.z < endpos.z) {
+        return true;
+    }
+    return false;
+}
+
+FillTileCursor::FillTileCursor(BlockPos startpos, BlockPos endpos)
+: mStartPos(startpos),
+  mEndPos(endpos),
+  mTilePos({alignToSubChunk(startpos.x), alignToSubChunk(startpos.y), alignToSubChunk(startpos.z)}),
+  mFinished(!checkFillPos(startpos, endpos)),
+  mTotalBlocks(0),
+  mProcessedBlocks(0) {
+    if (!mFinished) {
+        mTotalBlocks = (uint64)(endpos.x - startpos.x + 1) * (uint64)(endpos.y - startpos.y + 1)
+                     * (uint64)(endpos.z - startpos.z + 1);
+    }
+}
+
+// Players only hold the chunks inside their view radius, the others get the chunk from the server when they come closer.
+bool isChunkInView(Player& pl, DimensionType dimId, int chunkX, int chunkZ) {
+    if (pl.isSimulatedPlayer() || pl.getDimensionId() != dimId) {
+        return false;
+    }
+    auto&   pos    = pl.getPosition();
+    int64_t dx     = (int64_t)chunkX - ((int)std::floor(pos.x) >> 4);
+    int64_t dz     = (int64_t)chunkZ - ((int)std::floor(pos.z) >> 4);
+    int64_t radius = (int64_t)pl.getChunkRadius() + 1;
+    return dx * dx + dz * dz <= radius * radius;
+}
+
+bool FillTileCursor::next(BlockPos& tileStart, BlockPos& tileEnd) {
+    if (mFinished) {
+        return false;
+    }
+    tileStart = {
+        std::max(mTilePos.x, mStartPos.x),
+        std::max(mTilePos.y, mStartPos.y),
+        std::max(mTilePos.z, mStartPos.z)
+    };
+    tileEnd = {
+        std::min(mTilePos.x + SUBCHUNK_SIZE - 1, mEndPos.x),
+        std::min(mTilePos.y + SUBCHUNK_SIZE - 1, mEndPos.y),
+        std::min(mTilePos.z + SUBCHUNK_SIZE - 1, mEndPos.z)
+    };
+    mProcessedBlocks += (uint64)(tileEnd.x - tileStart.x + 1) * (uint64)(tileEnd.y - tileStart.y + 1)
+                      * (uint64)(tileEnd.z - tileStart.z + 1);
+    // Subchunks of the same chunk column are visited one after another.
+    mTilePos.y += SUBCHUNK_SIZE;
+    if (mTilePos.y > mEndPos.y) {
+        mTilePos.y  = alignToSubChunk(mStartPos.y);
+        mTilePos.z += SUBCHUNK_SIZE;
+        if (mTilePos.z > mEndPos.z) {
+            mTilePos.z  = alignToSubChunk(mStartPos.z);
+            mTilePos.x += SUBCHUNK_SIZE;
+            if (mTilePos.x > mEndPos.x) {
+                mFinished = true;
+            }
+        }
+    }
+    return true;
+}
+
+void sendSubChunkUpdate(
+    DimensionType                                         dimId,
+    BlockPos const&                                       tileStart,
+    std::vector<std::pair<BlockPos, Block const*>> const& changes
+) {
+    if (changes.empty()) {
+        return;
+    }
+    GMLIB_BinaryStream bs;
+    bs.mBuffer->reserve(16 + changes.size() * 12);
+    bs.writeVarInt(tileStart.x >> 4);
+    bs.writeVarInt(tileStart.y >> 4);
+    bs.writeVarInt(tileStart.z >> 4);
+    bs.writeUnsignedVarInt((uint)changes.size());
+    for (auto& [pos, block] : changes) {
+        bs.writeBlockPos(pos);
+        bs.writeUnsignedVarInt(block->getRuntimeId());
+        bs.writeUnsignedVarInt(CLIENT_UPDATE_FLAGS);
+        bs.writeUnsignedVarInt64(0); // SyncedUpdateActorUniqueId
+        bs.writeUnsignedVarInt(0);   // SyncedUpdateType
+    }
+    bs.writeUnsignedVarInt(0); // Extra (liquid) layer
+    auto                                      data = bs.getAndReleaseData();
+    GMLIB_NetworkPacket<UPDATE_SUBCHUNK_PKID> pkt(data);
+    ll::service::getLevel()->forEachPlayer([&](Player& pl) -> bool {
+        if (isChunkInView(pl, dimId, tileStart.x >> 4, tileStart.z >> 4)) {
+            pkt.sendTo(pl);
+        }
+        return true;
+    });
+}
+
+int fillTile(BlockSource& region, FillTask const& task, BlockPos const& tileStart, BlockPos const& tileEnd) {
+    int                                            count = 0;
+    std::vector<std::pair<BlockPos, Block const*>> changes;
+    changes.reserve(
+        (size_t)(tileEnd.x - tileStart.x + 1) * (tileEnd.y - tileStart.y + 1) * (tileEnd.z - tileStart.z + 1)
+    );
+    int          flags = mFillNeighbourUpdates ? FILL_UPDATE_FLAGS : NO_UPDATE_FLAGS;
+    Block const* air   = nullptr;
+    if (task.mMode == FillMode::Hollow && !task.mFilterBlock) {
+        air = Block::tryGetFromRegistry("minecraft:air", 0).as_ptr();
+    }
+    for (int y = tileStart.y; y <= tileEnd.y; y++) {
+        for (int z = tileStart.z; z <= tileEnd.z; z++) {
+            for (int x = tileStart.x; x <= tileEnd.x; x++) {
+                BlockPos     pos     = {x, y, z};
+                auto&        current = region.getBlock(pos);
+                Block const* target  = task.mBlock;
+                if (task.mFilterBlock) {
+                    if (&current != task.mFilterBlock) {
+                        continue;
+                    }
+                } else {
+                    switch (task.mMode) {
+                    case FillMode::Replace:
+                        break;
+                    case FillMode::Keep:
+                        if (!current.isAir()) {
+                            continue;
+                        }
+                        break;
+                    case FillMode::Outline:
+                        if (checkPosInRange(pos, task.mStartPos, task.mEndPos)) {
+                            continue;
+                        }
+                        break;
+                    case FillMode::Hollow:
+                        if (checkPosInRange(pos, task.mStartPos, task.mEndPos)) {
+                            target = air;
+                        }
+                        break;
+                    case FillMode::Destroy:
+                        ll::service::getLevel()->destroyBlock(region, pos, true);
+                        break;
+                    default:
+                        return count;
+                    }
+                }
+                count++;
+                if (!target || (&region.getBlock(pos) == target)) {
+                    continue;
+                }
+                region.setBlock(pos, *target, flags, nullptr, nullptr);
+                changes.emplace_back(pos, target);
+            }
+        }
+    }
+    sendSubChunkUpdate(task.mDimensionId, tileStart, changes);
+    return count;
+}
+
+int runFillTask(FillTask const& task) {
+    if (!task.mBlock || !checkFillPos(task.mStartPos, task.mEndPos)) {
+        return 0;
+    }
+    if (task.mMode < FillMode::Replace || task.mMode > FillMode::Destroy) {
+        return 0;
+    }
+    auto region = GMLIB_Level::getLevel()->getBlockSource(task.mDimensionId);
+    if (!region) {
+        return 0;
+    }
+    int            count = 0;
+    FillTileCursor cursor(task.mStartPos, task.mEndPos);
+    BlockPos       tileStart = {0, 0, 0};
+    BlockPos       tileEnd   = {0, 0, 0};
+    while (cursor.next(tileStart, tileEnd)) {
+        count += fillTile(*region, task, tileStart, tileEnd);
+    }
+    return count;
+}
+
+} // namespace GMLIB::LevelAPI
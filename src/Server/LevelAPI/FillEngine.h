@@ -0,0 +1,46 @@
+#pragma once
+#include "Global.h"
+#include <GMLIB/Server/LevelAPI.h>
+
+namespace GMLIB::LevelAPI {
+
+struct FillTask {
+    BlockPos      mStartPos;
+    BlockPos      mEndPos;
+    DimensionType mDimensionId;
+    Block const*  mBlock;
+    Block const*  mFilterBlock = nullptr; // Replace old block only, ignores mMode
+    FillMode      mMode        = FillMode::Replace;
+};
+
+// Walks a fill region in subchunk aligned tiles (16x16x16), chunk column by chunk column.
+class FillTileCursor {
+public:
+    BlockPos mStartPos;
+    BlockPos mEndPos;
+    BlockPos mTilePos;
+    bool     mFinished;
+    uint64   mTotalBlocks;
+    uint64   mProcessedBlocks;
+
+public:
+    FillTileCursor(BlockPos startpos, BlockPos endpos);
+
+    bool next(BlockPos& tileStart, BlockPos& tileEnd);
+};
+
+extern bool checkFillPos(BlockPos startpos, BlockPos endpos);
+
+extern int fillTile(BlockSource& region, FillTask const& task, BlockPos const& tileStart, BlockPos const& tileEnd);
+
+extern int runFillTask(FillTask const& task);
+
+extern std::shared_ptr<FillJob> submitFillJob(FillTask const& task, FillJobCallback callback);
+
+extern void processFillJobs();
+
+extern uint mFillJobTickBudget;
+
+extern bool mFillNeighbourUpdates;
+
+} // namespace GMLIB::LevelAPI
@@ -0,0 +1,183 @@
+#include "Server/LevelAPI/FillEngine.h"
+
+namespace GMLIB::LevelAPI {
+
+uint mFillJobTickBudget = 5000;
+
+class FillJobImpl : public FillJob {
+public:
+    FillTask                   mTask;
+    FillTileCursor             mCursor;
+    FillJobCallback            mCallback;
+    std::atomic<FillJobStatus> mStatus          = FillJobStatus::Pending;
+    std::atomic<uint64_t>      mProcessedBlocks = 0;
+    std::atomic<int>           mFilledCount     = 0;
+    std::atomic<bool>          mCancelRequested = false;
+
+public:
+    FillJobImpl(FillTask const& task, FillJobCallback callback)
+    : mTask(task),
+      mCursor(task.mStartPos, task.mEndPos),
+      mCallback(std::move(callback)) {}
+
+public:
+    FillJobStatus getStatus() const override { return mStatus; }
+
+    bool isFinished() const override {
+        auto status = mStatus.load();
+        return status == FillJobStatus::Completed || status == FillJobStatus::Cancelled;
+    }
+
+    float getProgress() const override {
+        if (mCursor.mTotalBlocks == 0) {
+            return isFinished() ? 1.0f : 0.0f;
+        }
+        return (float)((double)mProcessedBlocks / (double)mCursor.mTotalBlocks);
+    }
+
+    uint64_t getTotalBlocks() const override { return mCursor.mTotalBlocks; }
+
+    uint64_t getProcessedBlocks() const override { return mProcessedBlocks; }
+
+    int getFilledCount() const override { return mFilledCount; }
+
+    void cancel() override { mCancelRequested = true; }
+
+public:
+    // Returns true when the job is finished
+    bool advance(std::chrono::steady_clock::time_point deadline) {
+        if (mCancelRequested) {
+            return finish(FillJobStatus::Cancelled);
+        }
+        auto region = GMLIB_Level::getLevel()->getBlockSource(mTask.mDimensionId);
+        if (!region) {
+            return finish(FillJobStatus::Cancelled);
+        }
+        mStatus            = FillJobStatus::Running;
+        BlockPos tileStart = {0, 0, 0};
+        BlockPos tileEnd   = {0, 0, 0};
+        // At least one tile per tick, so that a tiny budget still makes progress.
+        do {
+            if (!mCursor.next(tileStart, tileEnd)) {
+                return finish(FillJobStatus::Completed);
+            }
+            mFilledCount     += fillTile(*region, mTask, tileStart, tileEnd);
+            mProcessedBlocks  = mCursor.mProcessedBlocks;
+        } while (std::chrono::steady_clock::now() < deadline && !mCancelRequested);
+        return false;
+    }
+
+    bool finish(FillJobStatus status) {
+        mStatus = status;
+        if (mCallback) {
+            try {
+                mCallback(*this);
+            } catch (...) {
+                logger.error("Exception in fill job callback!");
+            }
+        }
+        return true;
+    }
+};
+
+std::deque<std::shared_ptr<FillJobImpl>> mFillJobQueue;
+
+std::shared_ptr<FillJob> submitFillJob(FillTask const& task, FillJobCallback callback) {
+    if (!task.mBlock || !checkFillPos(task.mStartPos, task.mEndPos)) {
+        return nullptr;
+    }
+    if (task.mMode < FillMode::Replace || task.mMode > FillMode::Destroy) {
+        return nullptr;
+    }
+    auto job = std::make_shared<FillJobImpl>(task, std::move(callback));
+    mFillJobQueue.push_back(job);
+    return job;
+}
+
+void processFillJobs() {
+    if (mFillJobQueue.empty()) {
+        return;
+    }
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(mFillJobTickBudget);
+    while (!mFillJobQueue.empty()) {
+        auto job = mFillJobQueue.front();
+        if (!job->advance(deadline)) {
+            return;
+        }
+        mFillJobQueue.pop_front();
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return;
+        }
+    }
+}
+
+} // namespace GMLIB::LevelAPI
+
+void GMLIB_Level::setFillJobTickBudget(uint microseconds) { GMLIB::LevelAPI::mFillJobTickBudget = microseconds; }
+
+uint GMLIB_Level::getFillJobTickBudget() { return GMLIB::LevelAPI::mFillJobTickBudget; }
+
+void GMLIB_Level::setFillNeighbourUpdates(bool enabled) { GMLIB::LevelAPI::mFillNeighbourUpdates = enabled; }
+
+bool GMLIB_Level::getFillNeighbourUpdates() { return GMLIB::LevelAPI::mFillNeighbourUpdates; }
+
+std::shared_ptr<FillJob> GMLIB_Level::submitFillJob(
+    BlockPos        startpos,
+    BlockPos        endpos,
+    DimensionType   dimId,
+    Block*          block,
+    FillMode        mode,
+    FillJobCallback callback
+) {
+    GMLIB::LevelAPI::FillTask task = {startpos, endpos, dimId, block, nullptr, mode};
+    return GMLIB::LevelAPI::submitFillJob(task, std::move(callback));
+}
+
+std::shared_ptr<FillJob> GMLIB_Level::submitFillJob(
+    BlockPos        startpos,
+    BlockPos        endpos,
+    DimensionType   dimId,
+    std::string     name,
+    unsigned short  tileData,
+    FillMode        mode,
+    FillJobCallback callback
+) {
+    Block* block = (Block*)Block::tryGetFromRegistry(name, tileData).as_ptr();
+    if (block) {
+        return submitFillJob(startpos, endpos, dimId, block, mode, std::move(callback));
+    }
+    return nullptr;
+}
+
+std::shared_ptr<FillJob> GMLIB_Level::submitFillJob(
+    BlockPos        startpos,
+    BlockPos        endpos,
+    DimensionType   dimId,
+    Block*          newBlock,
+    Block*          oldBlock,
+    FillJobCallback callback
+) {
+    if (!oldBlock) {
+        return nullptr;
+    }
+    GMLIB::LevelAPI::FillTask task = {startpos, endpos, dimId, newBlock, oldBlock, FillMode::Replace};
+    return GMLIB::LevelAPI::submitFillJob(task, std::move(callback));
+}
+
+std::shared_ptr<FillJob> GMLIB_Level::submitFillJob(
+    BlockPos        startpos,
+    BlockPos        endpos,
+    DimensionType   dimId,
+    std::string     oldName,
+    unsigned short  oldTileData,
+    std::string     newName,
+    unsigned short  newTileData,
+    FillJobCallback callback
+) {
+    Block* newBlock = (Block*)Block::tryGetFromRegistry(newName, newTileData).as_ptr();
+    Block* oldBlock = (Block*)Block::tryGetFromRegistry(oldName, oldTileData).as_ptr();
+    if (newBlock && oldBlock) {
+        return submitFillJob(startpos, endpos, dimId, newBlock, oldBlock, std::move(callback));
+    }
+    return nullptr;
+}
@@ -1,11 +1,14 @@
 #include "GMLIB/Server/LevelAPI.h"
 #include "Global.h"
+#include "Server/LevelAPI/FillEngine.h"
+#include "Server/LevelAPI/TickStatistics.h"
+#include "Server/PlayerAPI/PacketQueueAPI.h"
 
-typedef std::chrono::high_resolution_clock timer_clock;
+typedef std::chrono::steady_clock timer_clock;
 #define TIMER_START auto start = timer_clock::now();
 #define TIMER_END                                                                                                      \
-    auto      elapsed    = timer_clock::now() - start;                                                                 \
-    long long timeReslut = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    auto      end        = timer_clock::now();                                                                         \
+    long long timeReslut = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
 
 namespace GMLIB::LevelAPI {
 
@@ -19,10 +22,8 @@ std::vector<::AllExperiments> mExperimentsRequireList   = {};
 bool                          mForceAchievementsEnabled = false;
 bool                          mRegAbilityCommand        = false;
 bool                          mEducationEditionEnabled  = false;
-uint                          mTicks                    = 0;
-float                         mAverageTps               = 20;
-double                        mMspt                     = 0;
-std::list<ushort>             mTickList                 = {};
+std::atomic<double>           mMspt                     = 0;
+TickStatistics                mTickStatistics;
 
 } // namespace GMLIB::LevelAPI
 
@@ -122,18 +123,42 @@ void GMLIB_Level::setClientWeather(WeatherType weather, Player* pl) {
     Vec3 pos = {0, 0, 0};
     switch (weather) {
     case WeatherType::Thunder: {
-        LevelEventPacket(LevelEvent::StartThunderstorm, pos, 65565).sendTo(*pl);
-        LevelEventPacket(LevelEvent::StartRaining, pos, 65565).sendTo(*pl);
+        GMLIB::PlayerAPI::sendPlayerPacket(
+            *pl,
+            LevelEventPacket(LevelEvent::StartThunderstorm, pos, 65565),
+            "weather:thunder"
+        );
+        GMLIB::PlayerAPI::sendPlayerPacket(
+            *pl,
+            LevelEventPacket(LevelEvent::StartRaining, pos, 65565),
+            "weather:rain"
+        );
         break;
     }
     case WeatherType::Rain: {
-        LevelEventPacket(LevelEvent::StopThunderstorm, pos, 0).sendTo(*pl);
-        LevelEventPacket(LevelEvent::StartRaining, pos, 65565).sendTo(*pl);
+        GMLIB::PlayerAPI::sendPlayerPacket(
+            *pl,
+            LevelEventPacket(LevelEvent::StopThunderstorm, pos, 0),
+            "weather:thunder"
+        );
+        GMLIB::PlayerAPI::sendPlayerPacket(
+            *pl,
+            LevelEventPacket(LevelEvent::StartRaining, pos, 65565),
+            "weather:rain"
+        );
         break;
     }
     default: {
-        LevelEventPacket(LevelEvent::StopThunderstorm, pos, 0).sendTo(*pl);
-        LevelEventPacket(LevelEvent::StopRaining, pos, 0).sendTo(*pl);
+        GMLIB::PlayerAPI::sendPlayerPacket(
+            *pl,
+            LevelEventPacket(LevelEvent::StopThunderstorm, pos, 0),
+            "weather:thunder"
+        );
+        GMLIB::PlayerAPI::sendPlayerPacket(
+            *pl,
+            LevelEventPacket(LevelEvent::StopRaining, pos, 0),
+            "weather:rain"
+        );
         break;
     }
     }
@@ -241,21 +266,6 @@ bool GMLIB_Level::setBlock(std::string name, short aux, BlockPos& pos, Dimension
     return getBlockSource(dimid)->setBlock(pos, block, 3, nullptr, nullptr);
 }
 
-bool checkFillPos(BlockPos startpos, BlockPos endpos) {
-    if (startpos.x <= endpos.x && startpos.y <= endpos.y && startpos.z <= endpos.z) {
-        return true;
-    }
-    return false;
-}
-
-bool checkPosInRange(BlockPos pos, BlockPos startpos, BlockPos endpos) {
-    if (pos.x > startpos.x && pos.y > startpos.y && pos.z > startpos.z && pos.x < endpos.x && pos.y < endpos.y
-        && pos.z < endpos.z) {
-        return true;
-    }
-    return false;
-}
-
 int GMLIB_Level::fillBlocks(
     BlockPos      startpos,
     BlockPos      endpos,
@@ -263,51 +273,8 @@ int GMLIB_Level::fillBlocks(
     Block*        block,
     FillMode      mode
 ) {
-    int  count       = 0;
-    auto blockSource = getBlockSource(dimensionId);
-    if (checkFillPos(startpos, endpos)) {
-        int lx = endpos.x - startpos.x;
-        int ly = endpos.y - startpos.y;
-        int lz = endpos.z - startpos.z;
-        for (int i = 0; i <= lx; i++) {
-            for (int j = 0; j <= ly; j++) {
-                for (int k = 0; k <= lz; k++) {
-                    BlockPos pos = {startpos.x + i, startpos.y + j, startpos.z + k};
-                    switch (mode) {
-                    case FillMode::Hollow:
-                        if (checkPosInRange(pos, startpos, endpos)) {
-                            blockSource->setBlock(pos, *block, 3, nullptr, nullptr);
-                            count++;
-                        }
-                    case FillMode::Outline:
-                        if (!checkPosInRange(pos, startpos, endpos)) {
-                            blockSource->setBlock(pos, *block, 3, nullptr, nullptr);
-                            count++;
-                        }
-                        break;
-
-                    case FillMode::Destroy:
-                        destroyBlock(*getBlockSource(dimensionId), pos, true);
-                    case FillMode::Replace:
-                        blockSource->setBlock(pos, *block, 3, nullptr, nullptr);
-                        count++;
-                        break;
-
-                    case FillMode::Keep:
-                        if (blockSource->getBlock(pos).isAir()) {
-                            blockSource->setBlock(pos, *block, 3, nullptr, nullptr);
-                            count++;
-                        }
-                        break;
-                    default:
-                        return 0;
-                    }
-                }
-            }
-        }
-        return count;
-    }
-    return 0;
+    GMLIB::LevelAPI::FillTask task = {startpos, endpos, dimensionId, block, nullptr, mode};
+    return GMLIB::LevelAPI::runFillTask(task);
 }
 
 int GMLIB_Level::fillBlocks(
@@ -326,26 +293,11 @@ int GMLIB_Level::fillBlocks(
 }
 
 int GMLIB_Level::fillBlocks(BlockPos startpos, BlockPos endpos, DimensionType dimId, Block* newblock, Block* oldblock) {
-    int  count       = 0;
-    auto blockSource = getBlockSource(dimId);
-    if (checkFillPos(startpos, endpos)) {
-        int lx = endpos.x - startpos.x;
-        int ly = endpos.y - startpos.y;
-        int lz = endpos.z - startpos.z;
-        for (int i = 0; i <= lx; i++) {
-            for (int j = 0; j <= ly; j++) {
-                for (int k = 0; k <= lz; k++) {
-                    BlockPos pos = {startpos.x + i, startpos.y + j, startpos.z + k};
-                    if ((Block*)&blockSource->getBlock(pos) == oldblock) {
-                        blockSource->setBlock(pos, *newblock, 3, nullptr, nullptr);
-                        count++;
-                    }
-                }
-            }
-        }
-        return count;
+    if (!oldblock) {
+        return 0;
     }
-    return 0;
+    GMLIB::LevelAPI::FillTask task = {startpos, endpos, dimId, newblock, oldblock, FillMode::Replace};
+    return GMLIB::LevelAPI::runFillTask(task);
 }
 
 int GMLIB_Level::fillBlocks(
@@ -367,12 +319,27 @@ int GMLIB_Level::fillBlocks(
 
 double GMLIB_Level::getServerMspt() { return GMLIB::LevelAPI::mMspt; }
 
-float GMLIB_Level::getServerAverageTps() { return GMLIB::LevelAPI::mAverageTps; }
+float GMLIB_Level::getServerAverageTps() { return (float)GMLIB::LevelAPI::mTickStatistics.getTps60s(); }
 
 float GMLIB_Level::getServerCurrentTps() {
-    return GMLIB::LevelAPI::mMspt <= 50 ? 20 : (float)(1000.0 / GMLIB::LevelAPI::mMspt);
+    double mspt = GMLIB::LevelAPI::mMspt;
+    return mspt <= 50 ? 20 : (float)(1000.0 / mspt);
 }
 
+double GMLIB_Level::getServerMsptP50() { return GMLIB::LevelAPI::mTickStatistics.getMsptP50(); }
+
+double GMLIB_Level::getServerMsptP95() { return GMLIB::LevelAPI::mTickStatistics.getMsptP95(); }
+
+double GMLIB_Level::getServerMsptP99() { return GMLIB::LevelAPI::mTickStatistics.getMsptP99(); }
+
+double GMLIB_Level::getServerMaxMspt() { return GMLIB::LevelAPI::mTickStatistics.getMaxMspt(); }
+
+float GMLIB_Level::getServerTps1s() { return (float)GMLIB::LevelAPI::mTickStatistics.getTps1s(); }
+
+float GMLIB_Level::getServerTps10s() { return (float)GMLIB::LevelAPI::mTickStatistics.getTps10s(); }
+
+float GMLIB_Level::getServerTps60s() { return (float)GMLIB::LevelAPI::mTickStatistics.getTps60s(); }
+
 void GMLIB_Level::setFreezeTick(bool freeze) { ll::service::getMinecraft()->setSimTimePause(freeze); }
 
 void GMLIB_Level::setTickScale(float scale) { ll::service::getMinecraft()->setSimTimeScale(scale); }
@@ -385,10 +352,11 @@ LL_AUTO_INSTANCE_HOOK(
     "?achievementsWillBeDisabledOnLoad@LevelData@@QEBA_NXZ",
     bool
 ) {
+    GMLIB_PROFILE_HOOK(Achieve1);
     if (GMLIB::LevelAPI::mForceAchievementsEnabled) {
         return false;
     }
-    return origin();
+    return GMLIB_PROFILE_ORIGIN(origin());
 }
 
 LL_AUTO_INSTANCE_HOOK(
@@ -397,10 +365,11 @@ LL_AUTO_INSTANCE_HOOK(
     "?hasAchievementsDisabled@LevelData@@QEBA_NXZ",
     bool
 ) {
+    GMLIB_PROFILE_HOOK(Achieve2);
     if (GMLIB::LevelAPI::mForceAchievementsEnabled) {
         return false;
     }
-    return origin();
+    return GMLIB_PROFILE_ORIGIN(origin());
 }
 
 LL_AUTO_INSTANCE_HOOK(
@@ -409,10 +378,11 @@ LL_AUTO_INSTANCE_HOOK(
     "?allowCheats@PropertiesSettings@@QEBA_NXZ",
     bool
 ) {
+    GMLIB_PROFILE_HOOK(AllowCheatsSetting);
     if (GMLIB::LevelAPI::mForceAchievementsEnabled) {
         return false;
     }
-    return origin();
+    return GMLIB_PROFILE_ORIGIN(origin());
 }
 
 void initExperiments(LevelData* leveldat) {
@@ -424,10 +394,11 @@ void initExperiments(LevelData* leveldat) {
 }
 
 LL_AUTO_INSTANCE_HOOK(isTrustSkin, ll::memory::HookPriority::Normal, "?isTrustedSkin@SerializedSkin@@QEBA_NXZ", bool) {
+    GMLIB_PROFILE_HOOK(isTrustSkin);
     if (GMLIB::LevelAPI::mForceTrustSkin) {
         return true;
     }
-    return origin();
+    return GMLIB_PROFILE_ORIGIN(origin());
 }
 
 LL_AUTO_TYPE_INSTANCE_HOOK(
@@ -438,11 +409,12 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     void,
     class BinaryStream& stream
 ) {
+    GMLIB_PROFILE_HOOK(ResourcePacksInfoPacketWrite);
     if (GMLIB::LevelAPI::mCoResourcePack) {
         this->mData.mResourcePackRequired    = true;
         this->mData.mForceServerPacksEnabled = false;
     }
-    return origin(stream);
+    return GMLIB_PROFILE_ORIGIN(origin(stream));
 }
 
 LL_AUTO_TYPE_INSTANCE_HOOK(
@@ -453,13 +425,14 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     void,
     class BinaryStream& stream
 ) {
+    GMLIB_PROFILE_HOOK(StartGamePacketWrite);
     if (GMLIB::LevelAPI::mFakeSeedEnabled) {
         this->mSettings.mSeed.mValue = GMLIB::LevelAPI::mFakeSeed;
     }
     if (GMLIB::LevelAPI::mFakeLevelNameEnabled) {
         this->mLevelName = GMLIB::LevelAPI::mFakeLevelName;
     }
-    return origin(stream);
+    return GMLIB_PROFILE_ORIGIN(origin(stream));
 }
 
 LL_AUTO_TYPE_INSTANCE_HOOK(
@@ -469,7 +442,8 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     "?educationFeaturesEnabled@LevelData@@QEBA_NXZ",
     bool
 ) {
-    auto res = origin();
+    GMLIB_PROFILE_HOOK(EduInit);
+    auto res = GMLIB_PROFILE_ORIGIN(origin());
     if (GMLIB::LevelAPI::mEducationEditionEnabled) {
         this->setEducationFeaturesEnabled(true);
         return true;
@@ -486,42 +460,38 @@ LL_AUTO_TYPE_INSTANCE_HOOK(
     void,
     class CommandRegistry& registry
 ) {
+    GMLIB_PROFILE_HOOK(RegAbility);
     if (GMLIB::LevelAPI::mEducationEditionEnabled == false && GMLIB::LevelAPI::mRegAbilityCommand == true) {
         AbilityCommand::setup(registry);
     }
-    return origin(registry);
+    return GMLIB_PROFILE_ORIGIN(origin(registry));
+}
+
+inline uint64_t getTimestampMicroseconds(timer_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count();
 }
 
-bool culculate_mspt = false;
 LL_AUTO_TYPE_INSTANCE_HOOK(LevelTickHook, ll::memory::HookPriority::Normal, Level, "?tick@Level@@UEAAXXZ", void) {
-    GMLIB::LevelAPI::mTicks++;
+    GMLIB_PROFILE_HOOK(LevelTickHook);
     TIMER_START
-    origin();
+    GMLIB_PROFILE_ORIGIN(origin());
+    GMLIB::LevelAPI::processFillJobs();
+    GMLIB::Server::UserCache::publishUserCache();
+    GMLIB::PlayerAPI::processAsyncNbt();
+    GMLIB::PlayerAPI::processPlayerIdIndex();
+    GMLIB::PlayerAPI::processSidebars();
+    GMLIB::PlayerAPI::processBossbars();
+    GMLIB::PlayerAPI::processPacketQueues();
     TIMER_END
-    culculate_mspt = true;
-    if (culculate_mspt) {
-        GMLIB::LevelAPI::mMspt = (double)timeReslut / 1000;
-        culculate_mspt         = false;
-    }
+    GMLIB::LevelAPI::mMspt = (double)timeReslut / 1000;
+    GMLIB::LevelAPI::mTickStatistics.recordTick(getTimestampMicroseconds(end), (uint32_t)timeReslut);
 }
 
 void CaculateTPS() {
     std::thread([] {
         while (true) {
             std::this_thread::sleep_for(std::chrono::seconds(1));
-            culculate_mspt = true;
-            GMLIB::LevelAPI::mTickList.push_back(GMLIB::LevelAPI::mTicks);
-            GMLIB::LevelAPI::mTicks = 0;
-            if (GMLIB::LevelAPI::mTickList.size() >= 60) {
-                GMLIB::LevelAPI::mTickList.clear();
-                continue;
-            }
-            uint ticks_minute = 0;
-            for (auto i : GMLIB::LevelAPI::mTickList) {
-                ticks_minute = ticks_minute + i;
-            }
-            float res                    = (float)ticks_minute / ((float)GMLIB::LevelAPI::mTickList.size());
-            GMLIB::LevelAPI::mAverageTps = res >= 20 ? 20 : res;
+            GMLIB::LevelAPI::mTickStatistics.collect(getTimestampMicroseconds(timer_clock::now()));
         }
     }).detach();
 }
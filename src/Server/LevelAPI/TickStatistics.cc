@@ -0,0 +1,171 @@
+#include "Server/LevelAPI/TickStatistics.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace GMLIB::LevelAPI {
+
+size_t MsptHistogram::getIndex(uint32_t value) {
+    if (value < SUB_BUCKET_COUNT) {
+        return value;
+    }
+    int  msb    = std::bit_width(value) - 1;
+    int  bucket = msb - SUB_BUCKET_BITS + 1;
+    auto sub    = (value >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1);
+    return (size_t)bucket * SUB_BUCKET_COUNT + sub;
+}
+
+uint32_t MsptHistogram::getValueFromIndex(size_t index) {
+    if (index < SUB_BUCKET_COUNT) {
+        return (uint32_t)index;
+    }
+    int      bucket = (int)(index / SUB_BUCKET_COUNT);
+    uint64_t sub    = index % SUB_BUCKET_COUNT;
+    int      shift  = bucket - 1;
+    uint64_t lower  = (SUB_BUCKET_COUNT + sub) << shift;
+    // Middle of the sub bucket range
+    return (uint32_t)std::min<uint64_t>(lower + ((1ull << shift) >> 1), UINT32_MAX);
+}
+
+void MsptHistogram::record(uint32_t value) {
+    mCounts[getIndex(value)]++;
+    mTotalCount++;
+}
+
+void MsptHistogram::add(MsptHistogram const& other) {
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        mCounts[i] += other.mCounts[i];
+    }
+    mTotalCount += other.mTotalCount;
+}
+
+void MsptHistogram::subtract(MsptHistogram const& other) {
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        mCounts[i] -= other.mCounts[i];
+    }
+    mTotalCount -= other.mTotalCount;
+}
+
+void MsptHistogram::clear() {
+    mCounts.fill(0);
+    mTotalCount = 0;
+}
+
+uint64_t MsptHistogram::getTotalCount() const { return mTotalCount; }
+
+uint32_t MsptHistogram::getValueAtPercentile(double percentile) const {
+    if (mTotalCount == 0) {
+        return 0;
+    }
+    percentile    = std::clamp(percentile, 0.0, 100.0);
+    auto target   = (uint64_t)std::ceil(percentile / 100.0 * (double)mTotalCount);
+    target        = std::max<uint64_t>(target, 1);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        seen += mCounts[i];
+        if (seen >= target) {
+            return getValueFromIndex(i);
+        }
+    }
+    return getValueFromIndex(BUCKET_COUNT - 1);
+}
+
+bool TickStatistics::recordTick(uint64_t timestamp, uint32_t duration) { return mRing.push({timestamp, duration}); }
+
+void TickStatistics::collect(uint64_t now) {
+    TickSample sample;
+    while (mRing.pop(sample)) {
+        auto second = sample.mTimestamp / 1000000;
+        if (!mStarted) {
+            mStarted       = true;
+            mCurrentSecond = second;
+        }
+        // Late samples are counted into the current second.
+        if (second > mCurrentSecond) {
+            advanceTo(second);
+        }
+        auto& slice = mSlices[mCurrentSlice];
+        slice.mTicks++;
+        slice.mMaxDuration = std::max(slice.mMaxDuration, sample.mDuration);
+        slice.mHistogram.record(sample.mDuration);
+    }
+    if (mStarted && now / 1000000 > mCurrentSecond) {
+        advanceTo(now / 1000000);
+    }
+    publish();
+}
+
+void TickStatistics::advanceTo(uint64_t second) {
+    if (second - mCurrentSecond > WINDOW_SECONDS) {
+        // Every completed second falls out of the window, they are all replaced by empty seconds.
+        for (size_t i = 0; i <= WINDOW_SECONDS; i++) {
+            completeCurrentSlice();
+        }
+        mCurrentSecond = second;
+        return;
+    }
+    while (mCurrentSecond < second) {
+        completeCurrentSlice();
+        mCurrentSecond++;
+    }
+}
+
+void TickStatistics::completeCurrentSlice() {
+    mWindowHistogram.add(mSlices[mCurrentSlice].mHistogram);
+    mCurrentSlice = (mCurrentSlice + 1) % mSlices.size();
+    auto& next    = mSlices[mCurrentSlice];
+    if (mCompletedSlices == WINDOW_SECONDS) {
+        mWindowHistogram.subtract(next.mHistogram);
+    } else {
+        mCompletedSlices++;
+    }
+    next.mTicks       = 0;
+    next.mMaxDuration = 0;
+    next.mHistogram.clear();
+}
+
+TickStatistics::Slice const& TickStatistics::getCompletedSlice(size_t age) const {
+    return mSlices[(mCurrentSlice + mSlices.size() - age) % mSlices.size()];
+}
+
+double TickStatistics::getWindowTps(size_t seconds) const {
+    seconds = std::min(seconds, mCompletedSlices);
+    if (seconds == 0) {
+        return MAX_TPS;
+    }
+    uint64_t ticks = 0;
+    for (size_t i = 1; i <= seconds; i++) {
+        ticks += getCompletedSlice(i).mTicks;
+    }
+    return std::min((double)ticks / (double)seconds, MAX_TPS);
+}
+
+void TickStatistics::publish() {
+    uint32_t maxDuration = 0;
+    for (size_t i = 1; i <= mCompletedSlices; i++) {
+        maxDuration = std::max(maxDuration, getCompletedSlice(i).mMaxDuration);
+    }
+    mP50    = mWindowHistogram.getValueAtPercentile(50) / 1000.0;
+    mP95    = mWindowHistogram.getValueAtPercentile(95) / 1000.0;
+    mP99    = mWindowHistogram.getValueAtPercentile(99) / 1000.0;
+    mMax    = maxDuration / 1000.0;
+    mTps1s  = getWindowTps(1);
+    mTps10s = getWindowTps(10);
+    mTps60s = getWindowTps(60);
+}
+
+double TickStatistics::getMsptP50() const { return mP50; }
+
+double TickStatistics::getMsptP95() const { return mP95; }
+
+double TickStatistics::getMsptP99() const { return mP99; }
+
+double TickStatistics::getMaxMspt() const { return mMax; }
+
+double TickStatistics::getTps1s() const { return mTps1s; }
+
+double TickStatistics::getTps10s() const { return mTps10s; }
+
+double TickStatistics::getTps60s() const { return mTps60s; }
+
+} // namespace GMLIB::LevelAPI
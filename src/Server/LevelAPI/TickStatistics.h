@@ -0,0 +1,138 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Engine independent, all times are in microseconds and passed in by the caller.
+namespace GMLIB::LevelAPI {
+
+struct TickSample {
+    uint64_t mTimestamp;
+    uint32_t mDuration;
+};
+
+// Lock-free ring buffer, one producer (level tick) and one consumer (statistics thread).
+template <size_t Capacity>
+class TickSampleRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    std::array<TickSample, Capacity> mBuffer{};
+    alignas(64) std::atomic<size_t> mHead = 0;
+    alignas(64) std::atomic<size_t> mTail = 0;
+
+public:
+    // Drops the sample when the consumer falls behind.
+    bool push(TickSample const& sample) {
+        auto head = mHead.load(std::memory_order_relaxed);
+        if (head - mTail.load(std::memory_order_acquire) >= Capacity) {
+            return false;
+        }
+        mBuffer[head & (Capacity - 1)] = sample;
+        mHead.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(TickSample& sample) {
+        auto tail = mTail.load(std::memory_order_relaxed);
+        if (tail == mHead.load(std::memory_order_acquire)) {
+            return false;
+        }
+        sample = mBuffer[tail & (Capacity - 1)];
+        mTail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+// Log-linear histogram (HDR style), 32 linear sub buckets per power of two, about 3% relative error.
+class MsptHistogram {
+public:
+    static constexpr int    SUB_BUCKET_BITS  = 5;
+    static constexpr int    SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static constexpr size_t BUCKET_COUNT     = (32 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+private:
+    std::array<uint32_t, BUCKET_COUNT> mCounts{};
+    uint64_t                           mTotalCount = 0;
+
+public:
+    static size_t getIndex(uint32_t value);
+
+    static uint32_t getValueFromIndex(size_t index);
+
+public:
+    void record(uint32_t value);
+
+    void add(MsptHistogram const& other);
+
+    void subtract(MsptHistogram const& other);
+
+    void clear();
+
+    uint64_t getTotalCount() const;
+
+    // percentile in [0, 100]
+    uint32_t getValueAtPercentile(double percentile) const;
+};
+
+class TickStatistics {
+public:
+    static constexpr size_t WINDOW_SECONDS = 60;
+    static constexpr double MAX_TPS        = 20.0;
+
+private:
+    struct Slice {
+        uint32_t      mTicks       = 0;
+        uint32_t      mMaxDuration = 0;
+        MsptHistogram mHistogram;
+    };
+
+    TickSampleRing<1024>                  mRing;
+    // Consumer side, the slot after the current one is always the oldest completed slice.
+    std::array<Slice, WINDOW_SECONDS + 1> mSlices{};
+    size_t                                mCurrentSlice    = 0;
+    uint64_t                              mCurrentSecond   = 0;
+    size_t                                mCompletedSlices = 0;
+    bool                                  mStarted         = false;
+    MsptHistogram                         mWindowHistogram;
+    // Published results, readable from any thread
+    std::atomic<double>                   mP50    = 0;
+    std::atomic<double>                   mP95    = 0;
+    std::atomic<double>                   mP99    = 0;
+    std::atomic<double>                   mMax    = 0;
+    std::atomic<double>                   mTps1s  = MAX_TPS;
+    std::atomic<double>                   mTps10s = MAX_TPS;
+    std::atomic<double>                   mTps60s = MAX_TPS;
+
+public:
+    // Producer side, called once per tick.
+    bool recordTick(uint64_t timestamp, uint32_t duration);
+
+    // Consumer side, drains recorded ticks and publishes the statistics of completed seconds.
+    void collect(uint64_t now);
+
+public:
+    // In milliseconds, over the last WINDOW_SECONDS completed seconds.
+    double getMsptP50() const;
+    double getMsptP95() const;
+    double getMsptP99() const;
+    double getMaxMspt() const;
+
+    double getTps1s() const;
+    double getTps10s() const;
+    double getTps60s() const;
+
+private:
+    void advanceTo(uint64_t second);
+
+    void completeCurrentSlice();
+
+    // age 1 is the last completed second
+    Slice const& getCompletedSlice(size_t age) const;
+
+    double getWindowTps(size_t seconds) const;
+
+    void publish();
+};
+
+} // namespace GMLIB::LevelAPI
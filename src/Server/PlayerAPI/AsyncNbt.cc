@@ -0,0 +1,249 @@
+#include "Global.h"
+#include "Server/PlayerAPI/KeyedTaskQueue.h"
+#include "Server/PlayerAPI/PlayerIdIndex.h"
+#include <GMLIB/Server/PlayerAPI.h>
+
+namespace GMLIB::PlayerAPI {
+
+constexpr uint32_t ASYNC_NBT_WORKERS = 2;
+
+KeyedTaskQueue mAsyncNbtQueue;
+
+// Everyone waiting for one task, merged tasks hand theirs to the task taking them over.
+template <typename T>
+struct TaskWaiters {
+    std::vector<std::function<void(T)>> mCallbacks;
+    std::vector<std::promise<T>>        mPromises;
+
+    void append(TaskWaiters& other) {
+        std::move(other.mCallbacks.begin(), other.mCallbacks.end(), std::back_inserter(mCallbacks));
+        std::move(other.mPromises.begin(), other.mPromises.end(), std::back_inserter(mPromises));
+        other.mCallbacks.clear();
+        other.mPromises.clear();
+    }
+};
+
+class LoadNbtTask : public KeyedTask {
+public:
+    std::string                               mServerId;
+    std::unique_ptr<CompoundTag>              mNbt;
+    TaskWaiters<std::unique_ptr<CompoundTag>> mWaiters;
+
+public:
+    explicit LoadNbtTask(std::string serverId) : mServerId(std::move(serverId)) {}
+
+    void run() override {
+        try {
+            std::string data;
+            if (GMLIB::Global<DBStorage>->loadData(mServerId, data, DBHelpers::Category::Player)) {
+                mNbt = CompoundTag::fromBinaryNbt(data);
+            }
+        } catch (...) {
+            mNbt.reset();
+        }
+        // Futures are fulfilled here, so that they can be waited on from any thread.
+        for (auto& promise : mWaiters.mPromises) {
+            promise.set_value(mNbt ? mNbt->clone() : nullptr);
+        }
+    }
+
+    void complete() override {
+        for (size_t i = 0; i < mWaiters.mCallbacks.size(); i++) {
+            auto last = i + 1 == mWaiters.mCallbacks.size();
+            if (mWaiters.mCallbacks[i]) {
+                mWaiters.mCallbacks[i](last || !mNbt ? std::move(mNbt) : mNbt->clone());
+            }
+        }
+    }
+
+    bool merge(KeyedTask& next) override {
+        auto load = dynamic_cast<LoadNbtTask*>(&next);
+        if (!load) {
+            return false;
+        }
+        mWaiters.append(load->mWaiters);
+        return true;
+    }
+};
+
+// Writes and deletes, a later one of the same kind replaces a queued one.
+class WriteNbtTask : public KeyedTask {
+public:
+    std::string                  mServerId;
+    std::unique_ptr<CompoundTag> mNbt;    // Null deletes the player
+    bool                         mOnline; // Checked on submit, same as deletePlayerNbt
+    bool                         mResult = false;
+    TaskWaiters<bool>            mWaiters;
+
+public:
+    WriteNbtTask(std::string serverId, std::unique_ptr<CompoundTag> nbt, bool online = false)
+    : mServerId(std::move(serverId)),
+      mNbt(std::move(nbt)),
+      mOnline(online) {}
+
+    void run() override {
+        try {
+            if (mServerId.empty()) {
+                mResult = false;
+            } else if (mNbt) {
+                GMLIB::Global<DBStorage>->saveData(mServerId, mNbt->toBinaryNbt(), DBHelpers::Category::Player);
+                mResult = true;
+            } else if (mOnline) {
+                // An online player may not have been saved yet.
+                ll::service::getLevel()->getLevelStorage().deleteData(mServerId, DBHelpers::Category::Player);
+                mResult = true;
+            } else if (GMLIB::Global<DBStorage>->hasKey(mServerId, DBHelpers::Category::Player)) {
+                GMLIB::Global<DBStorage>->deleteData(mServerId, DBHelpers::Category::Player);
+                mResult = true;
+            }
+        } catch (...) {
+            mResult = false;
+        }
+        if (mResult) {
+            invalidateServerId(mServerId);
+        }
+        for (auto& promise : mWaiters.mPromises) {
+            promise.set_value(mResult);
+        }
+    }
+
+    void complete() override {
+        for (auto& callback : mWaiters.mCallbacks) {
+            if (callback) {
+                callback(mResult);
+            }
+        }
+    }
+
+    bool merge(KeyedTask& next) override {
+        auto write = dynamic_cast<WriteNbtTask*>(&next);
+        if (!write || !write->mNbt != !mNbt) {
+            return false;
+        }
+        mNbt     = std::move(write->mNbt);
+        mOnline |= write->mOnline;
+        mWaiters.append(write->mWaiters);
+        return true;
+    }
+};
+
+// Finds the serverId of a uuid, then queues the load behind the pending writes of that player.
+class ResolveUuidTask : public KeyedTask {
+public:
+    mce::UUID                       mUuid;
+    bool                            mFound = false;
+    std::vector<OfflineNbtCallback> mCallbacks;
+
+public:
+    explicit ResolveUuidTask(mce::UUID const& uuid) : mUuid(uuid) {}
+
+    void run() override {
+        auto serverId = getServerId(mUuid);
+        if (serverId.empty()) {
+            return;
+        }
+        mFound    = true;
+        auto load = std::make_shared<LoadNbtTask>(serverId);
+        for (auto& callback : mCallbacks) {
+            // Same as getPlayerNbt, online players are saved on the server thread instead.
+            load->mWaiters.mCallbacks.emplace_back([serverId, callback](std::unique_ptr<CompoundTag> nbt) {
+                if (callback) {
+                    auto player = (GMLIB_Player*)ll::service::getLevel()->getPlayerFromServerId(serverId);
+                    callback(player ? player->getNbt() : std::move(nbt));
+                }
+            });
+        }
+        mAsyncNbtQueue.submit(serverId, std::move(load));
+    }
+
+    void complete() override {
+        if (mFound) {
+            return;
+        }
+        for (auto& callback : mCallbacks) {
+            if (callback) {
+                callback(nullptr);
+            }
+        }
+    }
+
+    bool merge(KeyedTask& next) override {
+        auto resolve = dynamic_cast<ResolveUuidTask*>(&next);
+        if (!resolve) {
+            return false;
+        }
+        std::move(resolve->mCallbacks.begin(), resolve->mCallbacks.end(), std::back_inserter(mCallbacks));
+        resolve->mCallbacks.clear();
+        return true;
+    }
+};
+
+void initAsyncNbt() { mAsyncNbtQueue.start(ASYNC_NBT_WORKERS); }
+
+void processAsyncNbt() { mAsyncNbtQueue.drainCompletions(); }
+
+void stopAsyncNbt() {
+    // Pending writes are finished, callbacks of a stopping server are dropped.
+    // Later requests run on the calling thread.
+    mAsyncNbtQueue.stop();
+}
+
+std::shared_ptr<WriteNbtTask> makeDeleteTask(std::string const& serverId) {
+    auto online = !serverId.empty() && ll::service::getLevel()->getPlayerFromServerId(serverId);
+    return std::make_shared<WriteNbtTask>(serverId, nullptr, online);
+}
+
+} // namespace GMLIB::PlayerAPI
+
+void GMLIB_Player::getOfflineNbtAsync(std::string const& serverId, OfflineNbtCallback callback) {
+    auto task = std::make_shared<GMLIB::PlayerAPI::LoadNbtTask>(serverId);
+    task->mWaiters.mCallbacks.push_back(std::move(callback));
+    GMLIB::PlayerAPI::mAsyncNbtQueue.submit(serverId, std::move(task));
+}
+
+std::future<std::unique_ptr<CompoundTag>> GMLIB_Player::getOfflineNbtAsync(std::string const& serverId) {
+    auto task   = std::make_shared<GMLIB::PlayerAPI::LoadNbtTask>(serverId);
+    auto future = task->mWaiters.mPromises.emplace_back().get_future();
+    GMLIB::PlayerAPI::mAsyncNbtQueue.submit(serverId, std::move(task));
+    return future;
+}
+
+void GMLIB_Player::getPlayerNbtAsync(mce::UUID const& uuid, OfflineNbtCallback callback) {
+    auto task = std::make_shared<GMLIB::PlayerAPI::ResolveUuidTask>(uuid);
+    task->mCallbacks.push_back(std::move(callback));
+    GMLIB::PlayerAPI::mAsyncNbtQueue.submit("uuid:" + uuid.asString(), std::move(task));
+}
+
+void GMLIB_Player::setOfflineNbtAsync(
+    std::string const&        serverId,
+    CompoundTag const&        nbt,
+    std::function<void(bool)> callback
+) {
+    auto task = std::make_shared<GMLIB::PlayerAPI::WriteNbtTask>(serverId, nbt.clone());
+    task->mWaiters.mCallbacks.push_back(std::move(callback));
+    GMLIB::PlayerAPI::mAsyncNbtQueue.submit(serverId, std::move(task));
+}
+
+std::future<bool> GMLIB_Player::setOfflineNbtAsync(std::string const& serverId, CompoundTag const& nbt) {
+    auto task   = std::make_shared<GMLIB::PlayerAPI::WriteNbtTask>(serverId, nbt.clone());
+    auto future = task->mWaiters.mPromises.emplace_back().get_future();
+    GMLIB::PlayerAPI::mAsyncNbtQueue.submit(serverId, std::move(task));
+    return future;
+}
+
+void GMLIB_Player::deletePlayerNbtAsync(std::string const& serverId, std::function<void(bool)> callback) {
+    auto task = GMLIB::PlayerAPI::makeDeleteTask(serverId);
+    task->mWaiters.mCallbacks.push_back(std::move(callback));
+    GMLIB::PlayerAPI::mAsyncNbtQueue.submit(serverId, std::move(task));
+}
+
+std::future<bool> GMLIB_Player::deletePlayerNbtAsync(std::string const& serverId) {
+    auto task   = GMLIB::PlayerAPI::makeDeleteTask(serverId);
+    auto future = task->mWaiters.mPromises.emplace_back().get_future();
+    GMLIB::PlayerAPI::mAsyncNbtQueue.submit(serverId, std::move(task));
+    return future;
+}
+
+size_t GMLIB_Player::getPendingAsyncNbtRequests() { return GMLIB::PlayerAPI::mAsyncNbtQueue.getQueuedCount(); }
+
+size_t GMLIB_Player::getMergedAsyncNbtRequests() { return GMLIB::PlayerAPI::mAsyncNbtQueue.getMergedCount(); }
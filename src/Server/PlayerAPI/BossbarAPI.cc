@@ -0,0 +1,198 @@
+#include "Global.h"
+#include "Server/PlayerAPI/BossbarState.h"
+#include "Server/PlayerAPI/PacketQueueAPI.h"
+#include <GMLIB/Server/ActorAPI.h>
+#include <GMLIB/Server/BinaryStreamAPI.h>
+#include <GMLIB/Server/NetworkPacketAPI.h>
+#include <GMLIB/Server/PlayerAPI.h>
+
+namespace GMLIB::PlayerAPI {
+
+// Changes are kept until the end of the tick, only the last value of each bossbar is sent.
+struct PlayerBossbars {
+    mce::UUID    mUuid;
+    BossbarState mState;
+    bool         mDirty       = false;
+    int          mDimensionId = 0; // The client drops its bossbars when the dimension changes
+};
+
+std::unordered_map<std::string, PlayerBossbars> mPlayerBossbars;
+std::vector<std::string>                        mDirtyBossbars;
+uint64_t                                        mBossbarTick           = 0;
+uint                                            mBossbarUpdateInterval = 1;
+
+void markBossbarsDirty(std::string const& key, PlayerBossbars& bossbars) {
+    if (!bossbars.mDirty) {
+        bossbars.mDirty = true;
+        mDirtyBossbars.push_back(key);
+    }
+}
+
+PlayerBossbars& getPlayerBossbars(Player& player) {
+    auto uuid = player.getUuid();
+    auto key  = uuid.asString();
+    auto it   = mPlayerBossbars.find(key);
+    if (it == mPlayerBossbars.end()) {
+        it = mPlayerBossbars.emplace(key, PlayerBossbars{uuid, {}, false, (int)player.getDimensionId()}).first;
+    }
+    markBossbarsDirty(key, it->second);
+    return it->second;
+}
+
+void resetClientBossbars(Player& player) {
+    auto key = player.getUuid().asString();
+    auto it  = mPlayerBossbars.find(key);
+    if (it == mPlayerBossbars.end()) {
+        return;
+    }
+    it->second.mDimensionId = (int)player.getDimensionId();
+    it->second.mState.reset();
+    markBossbarsDirty(key, it->second);
+}
+
+// The client only shows a bossbar for an actor it knows, it stays for every later update.
+void sendBossbarActor(Player& player, int64_t bossbarId) {
+    GMLIB_BinaryStream bs;
+    bs.writeVarInt64(bossbarId);
+    bs.writeUnsignedVarInt64(bossbarId);
+    bs.writeString("player");
+    bs.writeVec3(Vec3{player.getPosition().x, -66.0f, player.getPosition().z});
+    bs.writeVec3(Vec3{0, 0, 0});
+    bs.writeVec2(Vec2{0, 0});
+    bs.writeFloat(0.0f);
+    bs.writeFloat(0.0f);
+    bs.writeUnsignedVarInt(0);
+    bs.writeUnsignedVarInt(0);
+    bs.writeUnsignedVarInt(0);
+    bs.writeUnsignedVarInt(0);
+    bs.writeUnsignedVarInt(0);
+    sendPlayerPacket(player, (int)MinecraftPacketIds::AddActor, bs.getAndReleaseData());
+}
+
+void sendBossEvent(Player& player, int64_t bossbarId, BossbarState::Action action, BossbarValue const& value) {
+    if (action == BossbarState::Action::Show) {
+        sendBossbarActor(player, bossbarId);
+    }
+    GMLIB_BinaryStream bs;
+    bs.writeVarInt64(bossbarId);
+    bs.writeUnsignedVarInt((uint)action);
+    switch (action) {
+    case BossbarState::Action::Show:
+        bs.writeString(value.mTitle);
+        bs.writeFloat(value.mPercent);
+        bs.writeUnsignedShort(1);
+        bs.writeUnsignedVarInt(value.mColor);
+        bs.writeUnsignedVarInt(value.mOverlay);
+        break;
+    case BossbarState::Action::UpdatePercent:
+        bs.writeFloat(value.mPercent);
+        break;
+    case BossbarState::Action::UpdateTitle:
+        bs.writeString(value.mTitle);
+        break;
+    case BossbarState::Action::UpdateStyle:
+        bs.writeUnsignedVarInt(value.mColor);
+        bs.writeUnsignedVarInt(value.mOverlay);
+        break;
+    default:
+        break;
+    }
+    // A shown bar is only ever changed by its latest update of each kind.
+    std::string key;
+    if (action != BossbarState::Action::Show && action != BossbarState::Action::Hide) {
+        key = "bossbar:" + std::to_string(bossbarId) + ":" + std::to_string((int)action);
+    }
+    sendPlayerPacket(player, (int)MinecraftPacketIds::BossEvent, bs.getAndReleaseData(), key);
+}
+
+void processBossbars() {
+    mBossbarTick++;
+    auto level = ll::service::getLevel();
+    if (level && !mPlayerBossbars.empty()) {
+        level->forEachPlayer([](Player& player) -> bool {
+            auto it = mPlayerBossbars.find(player.getUuid().asString());
+            if (it != mPlayerBossbars.end() && it->second.mDimensionId != (int)player.getDimensionId()) {
+                resetClientBossbars(player);
+            }
+            return true;
+        });
+    }
+    if (mDirtyBossbars.empty()) {
+        return;
+    }
+    std::vector<std::string> waiting;
+    for (auto& key : mDirtyBossbars) {
+        auto it = mPlayerBossbars.find(key);
+        if (it == mPlayerBossbars.end()) {
+            continue;
+        }
+        auto& bossbars = it->second;
+        auto  player   = level ? level->getPlayer(bossbars.mUuid) : nullptr;
+        if (!player) {
+            mPlayerBossbars.erase(it);
+            continue;
+        }
+        bossbars.mState.flush(
+            mBossbarTick,
+            mBossbarUpdateInterval,
+            [&](int64_t id, BossbarState::Action action, BossbarValue const& value) {
+                sendBossEvent(*player, id, action, value);
+            }
+        );
+        // Updates held back by the interval are sent in a later tick.
+        if (bossbars.mState.hasPending()) {
+            waiting.push_back(key);
+        } else {
+            bossbars.mDirty = false;
+        }
+    }
+    mDirtyBossbars = std::move(waiting);
+}
+
+void initBossbars() {
+    ll::event::EventBus::getInstance().emplaceListener<ll::event::PlayerLeaveEvent>(
+        [](ll::event::PlayerLeaveEvent& event) { mPlayerBossbars.erase(event.self().getUuid().asString()); }
+    );
+    ll::event::EventBus::getInstance().emplaceListener<ll::event::PlayerRespawnEvent>(
+        [](ll::event::PlayerRespawnEvent& event) { resetClientBossbars(event.self()); }
+    );
+}
+
+} // namespace GMLIB::PlayerAPI
+
+void GMLIB_Player::setClientBossbar(
+    int64_t        bossbarId,
+    std::string    name,
+    float          percentage,
+    ::BossBarColor color,
+    int            overlay
+) {
+    GMLIB::PlayerAPI::getPlayerBossbars(*this).mState.set(
+        bossbarId,
+        {std::move(name), percentage, (int)color, overlay}
+    );
+}
+
+int64_t GMLIB_Player::setClientBossbar(std::string name, float percentage, ::BossBarColor color, int overlay) {
+    auto bossbarId = GMLIB_Actor::getNextActorUniqueID();
+    setClientBossbar(bossbarId, name, percentage, color, overlay);
+    return bossbarId;
+}
+
+void GMLIB_Player::removeClientBossbar(int64_t bossbarId) {
+    GMLIB::PlayerAPI::getPlayerBossbars(*this).mState.remove(bossbarId);
+}
+
+void GMLIB_Player::updateClientBossbar(
+    int64_t        bossbarId,
+    std::string    name,
+    float          percentage,
+    ::BossBarColor color,
+    int            overlay
+) {
+    setClientBossbar(bossbarId, std::move(name), percentage, color, overlay);
+}
+
+void GMLIB_Player::setBossbarUpdateInterval(uint ticks) { GMLIB::PlayerAPI::mBossbarUpdateInterval = ticks; }
+
+uint GMLIB_Player::getBossbarUpdateInterval() { return GMLIB::PlayerAPI::mBossbarUpdateInterval; }
@@ -0,0 +1,92 @@
+#include "Server/PlayerAPI/BossbarState.h"
+
+namespace GMLIB::PlayerAPI {
+
+void BossbarState::set(int64_t id, BossbarValue const& value) {
+    auto& bar = mBars[id];
+    // Hiding and showing again in one tick would only flicker.
+    bar.mHidePending = false;
+    bar.mPending     = value;
+}
+
+void BossbarState::remove(int64_t id) {
+    auto it = mBars.find(id);
+    if (it == mBars.end()) {
+        return;
+    }
+    if (!it->second.mSent) {
+        mBars.erase(it);
+        return;
+    }
+    it->second.mPending.reset();
+    it->second.mHidePending = true;
+}
+
+void BossbarState::reset() {
+    for (auto it = mBars.begin(); it != mBars.end();) {
+        auto& bar = it->second;
+        if (bar.mHidePending) {
+            it = mBars.erase(it);
+            continue;
+        }
+        if (bar.mSent && !bar.mPending) {
+            bar.mPending = std::move(bar.mSent);
+        }
+        bar.mSent.reset();
+        it++;
+    }
+}
+
+bool BossbarState::hasPending() const {
+    for (auto& [id, bar] : mBars) {
+        if (bar.mPending || bar.mHidePending) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool BossbarState::isShown(int64_t id) const {
+    auto it = mBars.find(id);
+    return it != mBars.end() && it->second.mSent;
+}
+
+void BossbarState::flush(uint64_t tick, uint64_t interval, Callback const& callback) {
+    for (auto it = mBars.begin(); it != mBars.end();) {
+        auto  id  = it->first;
+        auto& bar = it->second;
+        if (bar.mHidePending) {
+            callback(id, Action::Hide, *bar.mSent);
+            bar.mSent.reset();
+            bar.mHidePending = false;
+        }
+        if (bar.mPending && !bar.mSent) {
+            callback(id, Action::Show, *bar.mPending);
+            bar.mSent           = std::move(bar.mPending);
+            bar.mLastUpdateTick = tick;
+            bar.mPending.reset();
+        } else if (bar.mPending && tick - bar.mLastUpdateTick >= interval) {
+            auto& sent    = *bar.mSent;
+            auto& pending = *bar.mPending;
+            if (sent.mPercent != pending.mPercent) {
+                callback(id, Action::UpdatePercent, pending);
+            }
+            if (sent.mTitle != pending.mTitle) {
+                callback(id, Action::UpdateTitle, pending);
+            }
+            if (sent.mColor != pending.mColor || sent.mOverlay != pending.mOverlay) {
+                callback(id, Action::UpdateStyle, pending);
+            }
+            bar.mSent           = std::move(bar.mPending);
+            bar.mLastUpdateTick = tick;
+            bar.mPending.reset();
+        }
+        if (!bar.mSent && !bar.mPending) {
+            it = mBars.erase(it);
+        } else {
+            it++;
+        }
+    }
+}
+
+} // namespace GMLIB::PlayerAPI
@@ -0,0 +1,59 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+// Engine independent. The bossbars a client currently shows, so that changes are sent as BossEvent updates.
+namespace GMLIB::PlayerAPI {
+
+struct BossbarValue {
+    std::string mTitle;
+    float       mPercent = 0;
+    int         mColor   = 0;
+    int         mOverlay = 0;
+};
+
+class BossbarState {
+public:
+    // Matches the BossEvent variant sent for it.
+    enum class Action : int {
+        Show          = 0,
+        Hide          = 2,
+        UpdatePercent = 4,
+        UpdateTitle   = 5,
+        UpdateStyle   = 7
+    };
+
+    using Callback = std::function<void(int64_t id, Action action, BossbarValue const& value)>;
+
+private:
+    struct Bar {
+        std::optional<BossbarValue> mSent;
+        std::optional<BossbarValue> mPending;
+        bool                        mHidePending    = false;
+        uint64_t                    mLastUpdateTick = 0;
+    };
+
+    std::unordered_map<int64_t, Bar> mBars;
+
+public:
+    // Only the last value before a flush is sent.
+    void set(int64_t id, BossbarValue const& value);
+
+    void remove(int64_t id);
+
+    // The client dropped every bar (dimension change, respawn), the shown ones are shown again by the next flush.
+    void reset();
+
+    bool hasPending() const;
+
+    bool isShown(int64_t id) const;
+
+    // Calls callback for what has to be sent. Updates of a shown bar wait until interval ticks have passed since its
+    // last update, shows and hides are never held back.
+    void flush(uint64_t tick, uint64_t interval, Callback const& callback);
+};
+
+} // namespace GMLIB::PlayerAPI
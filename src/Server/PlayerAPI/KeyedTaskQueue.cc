@@ -0,0 +1,120 @@
+#include "Server/PlayerAPI/KeyedTaskQueue.h"
+
+namespace GMLIB::PlayerAPI {
+
+KeyedTaskQueue::~KeyedTaskQueue() { stop(); }
+
+void KeyedTaskQueue::start(uint32_t workerCount) {
+    std::lock_guard lock(mMutex);
+    if (!mWorkers.empty()) {
+        return;
+    }
+    mStopping = false;
+    for (uint32_t i = 0; i < workerCount; i++) {
+        mWorkers.emplace_back([this] { run(); });
+    }
+}
+
+void KeyedTaskQueue::stop() {
+    {
+        std::unique_lock lock(mMutex);
+        if (mWorkers.empty()) {
+            return;
+        }
+        mIdle.wait(lock, [this] { return mQueuedCount == 0; });
+        mStopping = true;
+    }
+    mReady.notify_all();
+    for (auto& worker : mWorkers) {
+        worker.join();
+    }
+    std::lock_guard lock(mMutex);
+    mWorkers.clear();
+}
+
+void KeyedTaskQueue::submit(std::string const& key, std::shared_ptr<KeyedTask> task) {
+    {
+        std::unique_lock lock(mMutex);
+        if (mStopping || mWorkers.empty()) {
+            // No worker would pick the task up.
+            lock.unlock();
+            try {
+                task->run();
+            } catch (...) {}
+            task->complete();
+            return;
+        }
+        auto& state = mKeys[key];
+        if (!state.mPending.empty() && state.mPending.back()->merge(*task)) {
+            mMergedCount++;
+            return;
+        }
+        state.mPending.push_back(std::move(task));
+        mQueuedCount++;
+        if (!state.mRunning && state.mPending.size() == 1) {
+            mReadyKeys.push_back(key);
+        }
+    }
+    mReady.notify_one();
+}
+
+size_t KeyedTaskQueue::drainCompletions() {
+    std::vector<std::shared_ptr<KeyedTask>> completed;
+    {
+        std::lock_guard lock(mMutex);
+        if (mCompleted.empty()) {
+            return 0;
+        }
+        completed.swap(mCompleted);
+    }
+    for (auto& task : completed) {
+        task->complete();
+    }
+    return completed.size();
+}
+
+size_t KeyedTaskQueue::getQueuedCount() {
+    std::lock_guard lock(mMutex);
+    return mQueuedCount;
+}
+
+size_t KeyedTaskQueue::getMergedCount() {
+    std::lock_guard lock(mMutex);
+    return mMergedCount;
+}
+
+void KeyedTaskQueue::run() {
+    std::unique_lock lock(mMutex);
+    while (true) {
+        mReady.wait(lock, [this] { return mStopping || !mReadyKeys.empty(); });
+        if (mReadyKeys.empty()) {
+            return;
+        }
+        auto key   = std::move(mReadyKeys.front());
+        auto state = &mKeys[key];
+        mReadyKeys.pop_front();
+        auto task = std::move(state->mPending.front());
+        state->mPending.pop_front();
+        state->mRunning = true;
+        lock.unlock();
+        try {
+            task->run();
+        } catch (...) {}
+        lock.lock();
+        // The map may have rehashed while unlocked.
+        state           = &mKeys[key];
+        state->mRunning = false;
+        if (!state->mPending.empty()) {
+            mReadyKeys.push_back(std::move(key));
+            mReady.notify_one();
+        } else {
+            mKeys.erase(key);
+        }
+        mCompleted.push_back(std::move(task));
+        if (--mQueuedCount == 0) {
+            mIdle.notify_all();
+        }
+    }
+}
+
+} // namespace GMLIB::PlayerAPI
@@ -0,0 +1,79 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Engine independent. Runs tasks on a worker pool, one task per key at a time in submission order,
+// and completes them on the thread calling drainCompletions.
+namespace GMLIB::PlayerAPI {
+
+class KeyedTask {
+public:
+    virtual ~KeyedTask() = default;
+
+    // Worker thread.
+    virtual void run() = 0;
+
+    // Thread calling drainCompletions.
+    virtual void complete() {}
+
+    // Called on the last queued task of a key that has not started yet, when next is submitted for the same key.
+    // Returns true when next is taken over, it is then neither run nor completed.
+    virtual bool merge(KeyedTask&) { return false; }
+};
+
+class KeyedTaskQueue {
+private:
+    struct KeyState {
+        std::deque<std::shared_ptr<KeyedTask>> mPending;
+        bool                                   mRunning = false;
+    };
+
+    std::mutex                                mMutex;
+    std::condition_variable                   mReady;
+    std::condition_variable                   mIdle;
+    std::unordered_map<std::string, KeyState> mKeys;
+    std::deque<std::string>                   mReadyKeys;
+    std::vector<std::shared_ptr<KeyedTask>>   mCompleted;
+    size_t                                    mQueuedCount = 0;
+    size_t                                    mMergedCount = 0;
+    bool                                      mStopping    = false;
+    std::vector<std::thread>                  mWorkers;
+
+public:
+    KeyedTaskQueue() = default;
+
+    KeyedTaskQueue(KeyedTaskQueue const&)            = delete;
+    KeyedTaskQueue& operator=(KeyedTaskQueue const&) = delete;
+
+    ~KeyedTaskQueue();
+
+public:
+    void start(uint32_t workerCount);
+
+    // Runs every queued task, then joins the workers. Completions are left to drainCompletions.
+    void stop();
+
+    // Before start() and after stop(), the task is run and completed on the calling thread instead.
+    void submit(std::string const& key, std::shared_ptr<KeyedTask> task);
+
+    // Returns the number of completed tasks.
+    size_t drainCompletions();
+
+    // Queued or running tasks.
+    size_t getQueuedCount();
+
+    // Tasks taken over by an earlier task of the same key.
+    size_t getMergedCount();
+
+private:
+    void run();
+};
+
+} // namespace GMLIB::PlayerAPI
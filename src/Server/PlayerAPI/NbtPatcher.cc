@@ -0,0 +1,60 @@
+#include "Server/PlayerAPI/NbtPatcher.h"
+#include "Server/PlayerAPI/NbtScanner.h"
+#include <vector>
+
+namespace GMLIB::PlayerAPI {
+
+// The encoded field, from its type byte to the end of its payload.
+inline std::string_view getFieldBytes(NbtScanner::Field const& field) {
+    auto begin = field.mName.data() - 3;
+    return {begin, (size_t)(field.mPayload.data() + field.mPayload.size() - begin)};
+}
+
+std::optional<std::string> NbtPatcher::patch(std::string_view data, std::string_view replacement) {
+    struct Replacement {
+        std::string_view mName;
+        std::string_view mBytes;
+        bool             mUsed = false;
+    };
+
+    std::vector<Replacement> replacements;
+    if (!NbtScanner::forEachField(replacement, [&](NbtScanner::Field const& field) {
+            replacements.push_back({field.mName, getFieldBytes(field)});
+            return true;
+        })) {
+        return std::nullopt;
+    }
+    // Root tag type and name, forEachField checks that it is a compound.
+    size_t           position = 0;
+    uint8_t          rootType = 0;
+    std::string_view rootName;
+    if (!NbtScanner::read(data, position, rootType) || !NbtScanner::readName(data, position, rootName)) {
+        return std::nullopt;
+    }
+    std::string result;
+    result.reserve(data.size() + replacement.size());
+    result.append(data.substr(0, position));
+    bool valid = NbtScanner::forEachField(data, [&](NbtScanner::Field const& field) {
+        for (auto& item : replacements) {
+            if (item.mName == field.mName) {
+                result.append(item.mBytes);
+                item.mUsed = true;
+                return true;
+            }
+        }
+        result.append(getFieldBytes(field));
+        return true;
+    });
+    if (!valid) {
+        return std::nullopt;
+    }
+    for (auto& item : replacements) {
+        if (!item.mUsed) {
+            result.append(item.mBytes);
+        }
+    }
+    result.push_back((char)NbtScanner::TagType::End);
+    return result;
+}
+
+} // namespace GMLIB::PlayerAPI
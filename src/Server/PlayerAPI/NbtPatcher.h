@@ -0,0 +1,17 @@
+#pragma once
+#include <optional>
+#include <string>
+#include <string_view>
+
+// Engine independent. Edits encoded NBT without decoding it, see NbtScanner.
+namespace GMLIB::PlayerAPI {
+
+class NbtPatcher {
+public:
+    // Both arguments are encoded root compounds. Each top level field of replacement takes the place of the field
+    // with the same name in data, or is appended when there is none. Every other field is copied byte for byte.
+    // Returns nullopt on malformed input.
+    static std::optional<std::string> patch(std::string_view data, std::string_view replacement);
+};
+
+} // namespace GMLIB::PlayerAPI
@@ -0,0 +1,146 @@
+#include "Server/PlayerAPI/NbtScanner.h"
+
+namespace GMLIB::PlayerAPI {
+
+bool NbtScanner::readName(std::string_view data, size_t& position, std::string_view& name) {
+    uint16_t size = 0;
+    if (!read(data, position, size) || data.size() - position < size) {
+        return false;
+    }
+    name      = data.substr(position, size);
+    position += size;
+    return true;
+}
+
+inline bool skipBytes(std::string_view data, size_t& position, uint64_t count) {
+    if (data.size() - position < count) {
+        return false;
+    }
+    position += (size_t)count;
+    return true;
+}
+
+inline bool skipArray(std::string_view data, size_t& position, size_t elementSize) {
+    int32_t count = 0;
+    if (!NbtScanner::read(data, position, count) || count < 0) {
+        return false;
+    }
+    return skipBytes(data, position, (uint64_t)count * elementSize);
+}
+
+inline size_t getFixedSize(NbtScanner::TagType type) {
+    switch (type) {
+    case NbtScanner::TagType::Byte:
+        return 1;
+    case NbtScanner::TagType::Short:
+        return 2;
+    case NbtScanner::TagType::Int:
+    case NbtScanner::TagType::Float:
+        return 4;
+    case NbtScanner::TagType::Int64:
+    case NbtScanner::TagType::Double:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+bool NbtScanner::skipPayload(std::string_view data, size_t& position, TagType type, int depth) {
+    if (depth > MAX_DEPTH) {
+        return false;
+    }
+    if (auto size = getFixedSize(type)) {
+        return skipBytes(data, position, size);
+    }
+    switch (type) {
+    case TagType::ByteArray:
+        return skipArray(data, position, 1);
+    case TagType::IntArray:
+        return skipArray(data, position, 4);
+    case TagType::Int64Array:
+        return skipArray(data, position, 8);
+    case TagType::String: {
+        std::string_view value;
+        return readName(data, position, value);
+    }
+    case TagType::List: {
+        uint8_t elementType = 0;
+        int32_t count       = 0;
+        if (!read(data, position, elementType) || !read(data, position, count) || count < 0) {
+            return false;
+        }
+        // Lists of numbers are skipped in one step.
+        if (auto size = getFixedSize((TagType)elementType)) {
+            return skipBytes(data, position, (uint64_t)count * size);
+        }
+        if (elementType == (uint8_t)TagType::End) {
+            return true;
+        }
+        for (int32_t i = 0; i < count; i++) {
+            if (!skipPayload(data, position, (TagType)elementType, depth + 1)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    case TagType::Compound: {
+        while (true) {
+            uint8_t fieldType = 0;
+            if (!read(data, position, fieldType)) {
+                return false;
+            }
+            if (fieldType == (uint8_t)TagType::End) {
+                return true;
+            }
+            std::string_view name;
+            if (!readName(data, position, name) || !skipPayload(data, position, (TagType)fieldType, depth + 1)) {
+                return false;
+            }
+        }
+    }
+    default:
+        return false;
+    }
+}
+
+std::optional<NbtScanner::Field> NbtScanner::findField(std::string_view data, std::string_view name) {
+    std::optional<Field> result;
+    forEachField(data, [&](Field const& field) {
+        if (field.mName == name) {
+            result = field;
+            return false;
+        }
+        return true;
+    });
+    return result;
+}
+
+std::optional<std::string_view> NbtScanner::getString(std::string_view data, std::string_view name) {
+    auto field = findField(data, name);
+    if (!field || field->mType != TagType::String) {
+        return {};
+    }
+    return field->mPayload.substr(sizeof(uint16_t));
+}
+
+std::optional<int64_t> NbtScanner::getInt64(std::string_view data, std::string_view name) {
+    auto    field    = findField(data, name);
+    int64_t value    = 0;
+    size_t  position = 0;
+    if (!field || field->mType != TagType::Int64 || !read(field->mPayload, position, value)) {
+        return {};
+    }
+    return value;
+}
+
+std::optional<int32_t> NbtScanner::getInt(std::string_view data, std::string_view name) {
+    auto    field    = findField(data, name);
+    int32_t value    = 0;
+    size_t  position = 0;
+    if (!field || field->mType != TagType::Int || !read(field->mPayload, position, value)) {
+        return {};
+    }
+    return value;
+}
+
+} // namespace GMLIB::PlayerAPI
@@ -0,0 +1,100 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+// Engine independent. Reads little endian binary NBT (the world DB format) in place without allocating.
+namespace GMLIB::PlayerAPI {
+
+class NbtScanner {
+public:
+    enum class TagType : uint8_t {
+        End        = 0,
+        Byte       = 1,
+        Short      = 2,
+        Int        = 3,
+        Int64      = 4,
+        Float      = 5,
+        Double     = 6,
+        ByteArray  = 7,
+        String     = 8,
+        List       = 9,
+        Compound   = 10,
+        IntArray   = 11,
+        Int64Array = 12,
+    };
+
+    // mPayload views the encoded value inside the scanned data, length prefixes included.
+    struct Field {
+        std::string_view mName;
+        TagType          mType;
+        std::string_view mPayload;
+    };
+
+    static constexpr int MAX_DEPTH = 512;
+
+public:
+    // Calls callback(Field const&) for each field of the root compound, until it returns false.
+    // Returns false on malformed data.
+    template <typename T>
+    static bool forEachField(std::string_view data, T&& callback);
+
+    static std::optional<Field> findField(std::string_view data, std::string_view name);
+
+    static std::optional<std::string_view> getString(std::string_view data, std::string_view name);
+
+    static std::optional<int64_t> getInt64(std::string_view data, std::string_view name);
+
+    static std::optional<int32_t> getInt(std::string_view data, std::string_view name);
+
+public:
+    template <typename T>
+    static bool read(std::string_view data, size_t& position, T& value) {
+        if (position > data.size() || data.size() - position < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data.data() + position, sizeof(T));
+        position += sizeof(T);
+        return true;
+    }
+
+    static bool readName(std::string_view data, size_t& position, std::string_view& name);
+
+    // Moves position behind the payload of a tag.
+    static bool skipPayload(std::string_view data, size_t& position, TagType type, int depth = 0);
+};
+
+template <typename T>
+bool NbtScanner::forEachField(std::string_view data, T&& callback) {
+    size_t           position = 0;
+    uint8_t          rootType = 0;
+    std::string_view rootName;
+    if (!read(data, position, rootType) || rootType != (uint8_t)TagType::Compound
+        || !readName(data, position, rootName)) {
+        return false;
+    }
+    while (true) {
+        uint8_t type = 0;
+        if (!read(data, position, type)) {
+            return false;
+        }
+        if (type == (uint8_t)TagType::End) {
+            return true;
+        }
+        std::string_view name;
+        if (!readName(data, position, name)) {
+            return false;
+        }
+        auto start = position;
+        if (!skipPayload(data, position, (TagType)type, 1)) {
+            return false;
+        }
+        Field field{name, (TagType)type, data.substr(start, position - start)};
+        if (!callback(field)) {
+            return true;
+        }
+    }
+}
+
+} // namespace GMLIB::PlayerAPI
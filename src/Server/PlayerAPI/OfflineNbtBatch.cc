@@ -0,0 +1,171 @@
+#include "Global.h"
+#include "Server/PlayerAPI/NbtPatcher.h"
+#include "Server/PlayerAPI/PlayerIdIndex.h"
+#include "Server/PlayerAPI/RecordPipeline.h"
+#include <GMLIB/Server/PlayerAPI.h>
+
+constexpr auto BATCH_PROGRESS_INTERVAL = std::chrono::milliseconds(100);
+
+OfflineNbtBatch::OfflineNbtBatch() = default;
+
+OfflineNbtBatch::~OfflineNbtBatch() = default;
+
+void OfflineNbtBatch::setNbt(std::string const& serverId, CompoundTag const& nbt) {
+    mEntries.push_back({serverId, nbt.clone(), {}});
+}
+
+void OfflineNbtBatch::setNbtTags(
+    std::string const&              serverId,
+    CompoundTag const&              nbt,
+    std::vector<std::string> const& tags
+) {
+    // Only the listed tags are kept, the rest of a large player is not needed.
+    auto selected = std::make_unique<CompoundTag>();
+    for (auto& tag : tags) {
+        if (auto value = nbt.get(tag)) {
+            selected->put(tag, value->copy());
+        }
+    }
+    mEntries.push_back({serverId, std::move(selected), tags});
+}
+
+void OfflineNbtBatch::deleteNbt(std::string const& serverId) { mEntries.push_back({serverId, nullptr, {}}); }
+
+size_t OfflineNbtBatch::size() const { return mEntries.size(); }
+
+void OfflineNbtBatch::clear() { mEntries.clear(); }
+
+void OfflineNbtBatch::setProgressCallback(ProgressCallback callback) { mProgressCallback = std::move(callback); }
+
+OfflineNbtBatchStatistics const& OfflineNbtBatch::getStatistics() const { return mStatistics; }
+
+bool OfflineNbtBatch::commit(uint threads) {
+    // Every edit of one player, applied in order by one worker.
+    struct Record {
+        std::string_view    mServerId;
+        std::vector<Entry*> mEntries;
+        std::string         mStored;
+        std::string         mEncoded;
+        bool                mFailed = false;
+    };
+
+    auto                                         start = std::chrono::steady_clock::now();
+    std::vector<Record>                          records;
+    std::unordered_map<std::string_view, size_t> recordIndex;
+    for (auto& entry : mEntries) {
+        if (entry.mServerId.empty()) {
+            continue;
+        }
+        auto [it, inserted] = recordIndex.try_emplace(entry.mServerId, records.size());
+        if (inserted) {
+            records.emplace_back().mServerId = entry.mServerId;
+        }
+        records[it->second].mEntries.push_back(&entry);
+    }
+    // Players whose first edit merges tags need their stored data, the DB is only read on this thread.
+    for (auto& record : records) {
+        auto& first    = *record.mEntries.front();
+        auto  serverId = std::string(record.mServerId);
+        if (first.mNbt && !first.mTags.empty()
+            && !GMLIB::Global<DBStorage>->loadData(serverId, record.mStored, DBHelpers::Category::Player)) {
+            logger.error("Failed to commit offline player batch, {} is not stored", serverId);
+            return false;
+        }
+    }
+    auto encode = [](Record& record) {
+        // Tag merges patch the encoded player as long as possible, it is only decoded after a full replacement.
+        std::string                  encoded = std::move(record.mStored);
+        std::unique_ptr<CompoundTag> nbt;
+        for (auto entry : record.mEntries) {
+            if (!entry->mNbt) {
+                encoded.clear();
+                nbt.reset();
+            } else if (entry->mTags.empty()) {
+                encoded.clear();
+                nbt = entry->mNbt->clone();
+            } else if (nbt) {
+                for (auto& tag : entry->mTags) {
+                    if (auto value = entry->mNbt->get(tag)) {
+                        nbt->put(tag, value->copy());
+                    }
+                }
+            } else if (!encoded.empty()) {
+                auto patched = GMLIB::PlayerAPI::NbtPatcher::patch(encoded, entry->mNbt->toBinaryNbt());
+                if (!patched) {
+                    record.mFailed = true;
+                    return;
+                }
+                encoded = std::move(*patched);
+            } else {
+                // Merging into a player deleted earlier in the batch.
+                record.mFailed = true;
+                return;
+            }
+        }
+        // An empty result deletes the player.
+        record.mEncoded = nbt ? nbt->toBinaryNbt() : std::move(encoded);
+    };
+    std::atomic<size_t> next    = 0;
+    std::atomic<size_t> encoded = 0;
+
+    auto run = [&](bool reportProgress) {
+        auto lastReport = std::chrono::steady_clock::now();
+        for (auto i = next++; i < records.size(); i = next++) {
+            try {
+                encode(records[i]);
+            } catch (...) {
+                records[i].mFailed = true;
+            }
+            encoded++;
+            if (reportProgress && mProgressCallback) {
+                auto now = std::chrono::steady_clock::now();
+                if (now - lastReport >= BATCH_PROGRESS_INTERVAL) {
+                    lastReport = now;
+                    mProgressCallback(encoded, records.size());
+                }
+            }
+        }
+    };
+    // The calling thread encodes as well, and reports the progress.
+    auto workerCount = std::min<size_t>(GMLIB::PlayerAPI::RecordPipeline::resolveWorkerCount(threads), records.size());
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < workerCount; i++) {
+        workers.emplace_back(run, false);
+    }
+    run(true);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    if (mProgressCallback) {
+        mProgressCallback(encoded, records.size());
+    }
+    for (auto& record : records) {
+        if (record.mFailed) {
+            logger.error("Failed to commit offline player batch, {} could not be encoded", record.mServerId);
+            return false;
+        }
+    }
+    auto                      encodedTime = std::chrono::steady_clock::now();
+    OfflineNbtBatchStatistics statistics;
+    LevelStorageWriteBatch    batch;
+    for (auto& record : records) {
+        auto serverId = std::string(record.mServerId);
+        if (record.mEncoded.empty()) {
+            batch.deleteKey(serverId, DBHelpers::Category::Player);
+        } else {
+            statistics.mBytes += record.mEncoded.size();
+            batch.putKey(serverId, std::move(record.mEncoded), DBHelpers::Category::Player);
+        }
+        statistics.mRecords++;
+    }
+    GMLIB::Global<DBStorage>->saveData(batch);
+    for (auto& record : records) {
+        GMLIB::PlayerAPI::invalidateServerId(std::string(record.mServerId));
+    }
+    auto end                  = std::chrono::steady_clock::now();
+    statistics.mEncodeSeconds = std::chrono::duration<double>(encodedTime - start).count();
+    statistics.mWriteSeconds  = std::chrono::duration<double>(end - encodedTime).count();
+    mStatistics               = statistics;
+    mEntries.clear();
+    return true;
+}
@@ -0,0 +1,42 @@
+#include "Server/PlayerAPI/PacketQueue.h"
+
+namespace GMLIB::PlayerAPI {
+
+std::optional<size_t> PacketQueue::push(int packetId, std::string data, std::string const& key) {
+    std::optional<size_t> superseded;
+    if (!key.empty()) {
+        auto [it, inserted] = mKeys.try_emplace(key, mEntries.size());
+        if (!inserted) {
+            auto& entry = mEntries[it->second];
+            superseded  = entry->mData.size();
+            entry.reset();
+            mSize--;
+            it->second = mEntries.size();
+        }
+    }
+    mEntries.push_back(Entry{packetId, std::move(data)});
+    mSize++;
+    return superseded;
+}
+
+void PacketQueue::flush(std::function<void(Entry const& entry)> const& callback) {
+    auto entries = std::move(mEntries);
+    clear();
+    for (auto& entry : entries) {
+        if (entry) {
+            callback(*entry);
+        }
+    }
+}
+
+void PacketQueue::clear() {
+    mEntries.clear();
+    mKeys.clear();
+    mSize = 0;
+}
+
+bool PacketQueue::empty() const { return mSize == 0; }
+
+size_t PacketQueue::size() const { return mSize; }
+
+} // namespace GMLIB::PlayerAPI
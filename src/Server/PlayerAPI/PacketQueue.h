@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Engine independent. Packets of one player kept until the end of the tick, a packet with the key of an earlier
+// queued packet replaces it.
+namespace GMLIB::PlayerAPI {
+
+class PacketQueue {
+public:
+    struct Entry {
+        int         mPacketId;
+        std::string mData;
+    };
+
+private:
+    std::vector<std::optional<Entry>>       mEntries; // Superseded entries are left empty
+    std::unordered_map<std::string, size_t> mKeys;    // Index of the queued entry with the key
+    size_t                                  mSize = 0;
+
+public:
+    // The latest packet with a key is sent in its own place, after everything queued before it. An empty key never
+    // supersedes. Returns the payload size of the superseded packet.
+    std::optional<size_t> push(int packetId, std::string data, std::string const& key = {});
+
+    // Calls callback in queue order and empties the queue.
+    void flush(std::function<void(Entry const& entry)> const& callback);
+
+    void clear();
+
+    bool empty() const;
+
+    size_t size() const;
+};
+
+} // namespace GMLIB::PlayerAPI
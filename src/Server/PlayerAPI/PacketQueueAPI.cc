@@ -0,0 +1,128 @@
+#include "Server/PlayerAPI/PacketQueueAPI.h"
+#include "Server/PlayerAPI/PacketQueue.h"
+#include <GMLIB/Server/BinaryStreamAPI.h>
+#include <GMLIB/Server/NetworkPacketAPI.h>
+#include <GMLIB/Server/PlayerAPI.h>
+
+namespace GMLIB::PlayerAPI {
+
+struct PlayerPacketQueue {
+    mce::UUID   mUuid;
+    PacketQueue mQueue;
+};
+
+std::unordered_map<std::string, PlayerPacketQueue> mPlayerPacketQueues; // Players with the queue enabled
+PacketQueueStatistics                              mPacketQueueStatistics;
+
+// Packets are queued encoded, so the id is only known at runtime.
+class QueuedPacket : public GMLIB_NetworkPacket<0> {
+public:
+    MinecraftPacketIds mPacketId;
+
+public:
+    QueuedPacket(MinecraftPacketIds packetId, std::string_view data)
+    : GMLIB_NetworkPacket<0>(data),
+      mPacketId(packetId) {}
+
+public:
+    ::MinecraftPacketIds getId() const override { return mPacketId; }
+};
+
+void sendRawPacket(Player& player, int packetId, std::string_view data) {
+    QueuedPacket pkt((MinecraftPacketIds)packetId, data);
+    pkt.sendTo(player);
+}
+
+void sendPlayerPacket(Player& player, int packetId, std::string data, std::string const& key) {
+    auto it = mPlayerPacketQueues.find(player.getUuid().asString());
+    if (it == mPlayerPacketQueues.end()) {
+        sendRawPacket(player, packetId, data);
+        return;
+    }
+    mPacketQueueStatistics.mQueued++;
+    if (auto superseded = it->second.mQueue.push(packetId, std::move(data), key)) {
+        mPacketQueueStatistics.mSuperseded++;
+        mPacketQueueStatistics.mSavedBytes += *superseded;
+    }
+}
+
+void sendPlayerPacket(Player& player, Packet const& packet, std::string const& key) {
+    if (!mPlayerPacketQueues.contains(player.getUuid().asString())) {
+        packet.sendTo(player);
+        return;
+    }
+    GMLIB_BinaryStream bs;
+    packet.write(bs);
+    sendPlayerPacket(player, (int)packet.getId(), bs.getAndReleaseData(), key);
+}
+
+void sendAllPlayersPacket(Packet const& packet, std::string const& key) {
+    auto level = ll::service::getLevel();
+    if (mPlayerPacketQueues.empty() || !level) {
+        packet.sendToClients();
+        return;
+    }
+    GMLIB_BinaryStream bs;
+    packet.write(bs);
+    auto data = bs.getAndReleaseData();
+    level->forEachPlayer([&](Player& player) -> bool {
+        if (!player.isSimulatedPlayer()) {
+            sendPlayerPacket(player, (int)packet.getId(), data, key);
+        }
+        return true;
+    });
+}
+
+void processPacketQueues() {
+    auto level = ll::service::getLevel();
+    for (auto it = mPlayerPacketQueues.begin(); it != mPlayerPacketQueues.end();) {
+        auto& [uuid, queue] = it->second;
+        auto  player        = level ? level->getPlayer(uuid) : nullptr;
+        if (!player) {
+            it = mPlayerPacketQueues.erase(it);
+            continue;
+        }
+        if (!queue.empty()) {
+            mPacketQueueStatistics.mFlushes++;
+            queue.flush([&](PacketQueue::Entry const& entry) {
+                sendRawPacket(*player, entry.mPacketId, entry.mData);
+                mPacketQueueStatistics.mSent++;
+            });
+        }
+        it++;
+    }
+}
+
+void initPacketQueues() {
+    ll::event::EventBus::getInstance().emplaceListener<ll::event::PlayerLeaveEvent>(
+        [](ll::event::PlayerLeaveEvent& event) { mPlayerPacketQueues.erase(event.self().getUuid().asString()); }
+    );
+}
+
+} // namespace GMLIB::PlayerAPI
+
+void GMLIB_Player::setPacketQueueEnabled(bool enabled) {
+    auto key = getUuid().asString();
+    if (enabled) {
+        GMLIB::PlayerAPI::mPlayerPacketQueues[key].mUuid = getUuid();
+        return;
+    }
+    auto it = GMLIB::PlayerAPI::mPlayerPacketQueues.find(key);
+    if (it != GMLIB::PlayerAPI::mPlayerPacketQueues.end()) {
+        // Nothing queued is lost.
+        auto queue = std::move(it->second.mQueue);
+        GMLIB::PlayerAPI::mPlayerPacketQueues.erase(it);
+        queue.flush([&](GMLIB::PlayerAPI::PacketQueue::Entry const& entry) {
+            GMLIB::PlayerAPI::sendRawPacket(*this, entry.mPacketId, entry.mData);
+            GMLIB::PlayerAPI::mPacketQueueStatistics.mSent++;
+        });
+    }
+}
+
+bool GMLIB_Player::isPacketQueueEnabled() {
+    return GMLIB::PlayerAPI::mPlayerPacketQueues.contains(getUuid().asString());
+}
+
+PacketQueueStatistics GMLIB_Player::getPacketQueueStatistics() { return GMLIB::PlayerAPI::mPacketQueueStatistics; }
+
+void GMLIB_Player::resetPacketQueueStatistics() { GMLIB::PlayerAPI::mPacketQueueStatistics = {}; }
@@ -0,0 +1,16 @@
+#pragma once
+#include "Global.h"
+
+// GMLIB packets to a single player go through here, so that players with the packet queue enabled get them in one
+// batch at the end of the tick.
+namespace GMLIB::PlayerAPI {
+
+// A queued packet with the same key is dropped, use a key only when the later packet fully replaces the earlier one.
+extern void sendPlayerPacket(Player& player, int packetId, std::string data, std::string const& key = {});
+
+extern void sendPlayerPacket(Player& player, Packet const& packet, std::string const& key = {});
+
+// Sends to every client, players with the queue enabled get the packet in their queue.
+extern void sendAllPlayersPacket(Packet const& packet, std::string const& key = {});
+
+} // namespace GMLIB::PlayerAPI
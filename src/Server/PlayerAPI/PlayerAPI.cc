@@ -1,4 +1,8 @@
 #include "Global.h"
+#include "Server/PlayerAPI/NbtPatcher.h"
+#include "Server/PlayerAPI/NbtScanner.h"
+#include "Server/PlayerAPI/PlayerIdIndex.h"
+#include "Server/PlayerAPI/RecordPipeline.h"
 #include <GMLIB/Server/ActorAPI.h>
 #include <GMLIB/Server/BinaryStreamAPI.h>
 #include <GMLIB/Server/NetworkPacketAPI.h>
@@ -12,8 +16,19 @@ void forEachUuid(bool includeOfflineSignedId, std::function<void(std::string_vie
         DBHelpers::Category::Player,
         [&callback, includeOfflineSignedId](std::string_view key_left, std::string_view data) {
             if (key_left.size() == 36) {
-                auto  tag   = CompoundTag::fromBinaryNbt(data);
-                auto& msaId = tag->getString("MsaId");
+                // Only two top level strings are needed, the tag is scanned in place instead of being parsed.
+                std::string_view msaId;
+                std::string_view selfSignedId;
+                GMLIB::PlayerAPI::NbtScanner::forEachField(data, [&](auto const& field) {
+                    if (field.mType == GMLIB::PlayerAPI::NbtScanner::TagType::String) {
+                        if (field.mName == "MsaId") {
+                            msaId = field.mPayload.substr(2);
+                        } else if (field.mName == "SelfSignedId") {
+                            selfSignedId = field.mPayload.substr(2);
+                        }
+                    }
+                    return msaId.empty();
+                });
                 if (!msaId.empty()) {
                     if (msaId == key_left) {
                         callback(msaId);
@@ -23,7 +38,6 @@ void forEachUuid(bool includeOfflineSignedId, std::function<void(std::string_vie
                 if (!includeOfflineSignedId) {
                     return;
                 }
-                auto& selfSignedId = tag->getString("SelfSignedId");
                 if (!selfSignedId.empty()) {
                     if (selfSignedId == key_left) {
                         callback(selfSignedId);
@@ -41,6 +55,48 @@ std::vector<std::string> GMLIB_Player::getAllUuids(bool includeOfflineSignedId)
     return uuids;
 }
 
+uint GMLIB_Player::getOfflinePlayerScanThreads(uint threads) {
+    return GMLIB::PlayerAPI::RecordPipeline::resolveWorkerCount(threads);
+}
+
+void GMLIB_Player::scanOfflinePlayerRecords(
+    std::function<void(uint workerIndex, std::string_view serverId, std::string_view nbt)> const& visitor,
+    uint                                                                                          threads
+) {
+    // The DB iterator stays on this thread, only the copied records are handed to the workers.
+    constexpr std::string_view       prefix = "player_server_";
+    GMLIB::PlayerAPI::RecordPipeline pipeline(visitor, getOfflinePlayerScanThreads(threads));
+    std::string                      serverId;
+    GMLIB::Global<DBStorage>->forEachKeyWithPrefix(
+        prefix,
+        DBHelpers::Category::Player,
+        [&](std::string_view key_left, std::string_view data) {
+            serverId.assign(prefix);
+            serverId += key_left;
+            pipeline.push(serverId, data);
+        }
+    );
+    pipeline.finish();
+    if (auto failed = pipeline.getFailedCount()) {
+        logger.error("{} player records could not be scanned", failed);
+    }
+}
+
+void GMLIB_Player::scanOfflinePlayerTags(
+    std::function<void(uint workerIndex, std::string const& serverId, CompoundTag& nbt)> const& visitor,
+    uint                                                                                        threads
+) {
+    scanOfflinePlayerRecords(
+        [&visitor](uint workerIndex, std::string_view serverId, std::string_view data) {
+            auto nbt = CompoundTag::fromBinaryNbt(data);
+            if (nbt) {
+                visitor(workerIndex, std::string(serverId), *nbt);
+            }
+        },
+        threads
+    );
+}
+
 std::unique_ptr<CompoundTag> GMLIB_Player::getUuidDBTag(mce::UUID const& uuid) {
     auto& dbStorage = *GMLIB::Global<DBStorage>;
     auto  playerKey = "player_" + uuid.asString();
@@ -50,13 +106,7 @@ std::unique_ptr<CompoundTag> GMLIB_Player::getUuidDBTag(mce::UUID const& uuid) {
     return {};
 }
 
-std::string GMLIB_Player::getServerIdFromUuid(mce::UUID const& uuid) {
-    auto DBTag = getUuidDBTag(uuid);
-    if (!DBTag) {
-        return "";
-    }
-    return DBTag->getString("ServerId");
-}
+std::string GMLIB_Player::getServerIdFromUuid(mce::UUID const& uuid) { return GMLIB::PlayerAPI::getServerId(uuid); }
 
 std::unique_ptr<CompoundTag> GMLIB_Player::getOfflineNbt(std::string& serverId) {
     if (!GMLIB::Global<DBStorage>->hasKey(serverId, DBHelpers::Category::Player)) {
@@ -71,6 +121,7 @@ bool GMLIB_Player::setOfflineNbt(std::string& serverId, CompoundTag& nbt) {
             return false;
         }
         GMLIB::Global<DBStorage>->saveData(serverId, nbt.toBinaryNbt(), DBHelpers::Category::Player);
+        GMLIB::PlayerAPI::invalidateServerId(serverId);
         return true;
     } catch (...) {
         return false;
@@ -134,11 +185,22 @@ bool GMLIB_Player::setPlayerNbtTags(std::string& serverId, CompoundTag& nbt, con
     if (player) {
         auto data = player->getNbt();
         setNbtTags(*data, nbt, tags);
-        return player->load(nbt);
+        return player->load(*data);
+    }
+    // Only the changed tags are encoded, the rest of the stored player is copied as is.
+    std::string stored;
+    if (!GMLIB::Global<DBStorage>->loadData(serverId, stored, DBHelpers::Category::Player)) {
+        return false;
+    }
+    CompoundTag selected;
+    setNbtTags(selected, nbt, tags);
+    auto patched = GMLIB::PlayerAPI::NbtPatcher::patch(stored, selected.toBinaryNbt());
+    if (!patched) {
+        return false;
     }
-    auto data = getOfflineNbt(serverId);
-    setNbtTags(*data, nbt, tags);
-    return setOfflineNbt(serverId, *data);
+    GMLIB::Global<DBStorage>->saveData(serverId, std::move(*patched), DBHelpers::Category::Player);
+    GMLIB::PlayerAPI::invalidateServerId(serverId);
+    return true;
 }
 
 bool GMLIB_Player::setPlayerNbtTags(mce::UUID const& uuid, CompoundTag& nbt, const std::vector<std::string>& tags) {
@@ -153,10 +215,12 @@ bool GMLIB_Player::deletePlayerNbt(std::string& serverId) {
     auto pl = ll::service::getLevel()->getPlayerFromServerId(serverId);
     if (pl) {
         ll::service::getLevel()->getLevelStorage().deleteData(serverId, DBHelpers::Category::Player);
+        GMLIB::PlayerAPI::invalidateServerId(serverId);
         return true;
     }
     if (GMLIB::Global<DBStorage>->hasKey(serverId, DBHelpers::Category::Player)) {
         GMLIB::Global<DBStorage>->deleteData(serverId, DBHelpers::Category::Player);
+        GMLIB::PlayerAPI::invalidateServerId(serverId);
         return true;
     }
     return false;
@@ -173,41 +237,6 @@ bool GMLIB_Player::deletePlayerNbt(mce::UUID& uuid) {
 }
 
 
-void GMLIB_Player::setClientSidebar(
-    const std::string                               title,
-    const std::vector<std::pair<std::string, int>>& data,
-    ObjectiveSortOrder                              sortOrder
-) {
-    SetDisplayObjectivePacket("sidebar", "GMLIB_SIDEBAR_API", title, "dummy", ObjectiveSortOrder(sortOrder))
-        .sendTo(*this);
-
-    std::vector<ScorePacketInfo> info;
-    for (auto& key : data) {
-        auto                idValue   = GMLIB_Actor::getNextActorUniqueID();
-        const ScoreboardId& id        = ScoreboardId(idValue);
-        auto                text      = key.first;
-        auto                scoreInfo = ScorePacketInfo();
-        scoreInfo.mScoreboardId       = id;
-        scoreInfo.mObjectiveName      = "GMLIB_SIDEBAR_API";
-        scoreInfo.mIdentityType       = IdentityDefinition::Type::FakePlayer;
-        scoreInfo.mScoreValue         = key.second;
-        scoreInfo.mFakePlayerName     = text;
-        info.emplace_back(scoreInfo);
-    }
-    auto pkt        = (SetScorePacket*)(MinecraftPackets::createPacket(MinecraftPacketIds::SetScore).get());
-    pkt->mType      = (ScorePacketType)0;
-    pkt->mScoreInfo = info;
-    pkt->sendTo(*this);
-
-    SetDisplayObjectivePacket("sidebar", "GMLIB_SIDEBAR_API", title, "dummy", ObjectiveSortOrder(sortOrder))
-        .sendTo(*this);
-}
-
-
-void GMLIB_Player::removeClientSidebar() {
-    SetDisplayObjectivePacket("sidebar", "", "", "dummy", ObjectiveSortOrder::Ascending).sendTo(*this);
-}
-
 void GMLIB_Player::setHealth(int value) {
     return getMutableAttribute(SharedAttributes::HEALTH)->setCurrentValue(value);
 }
@@ -252,71 +281,6 @@ void GMLIB_Player::setClientGamemode(GameType gamemode) {
     UpdatePlayerGameTypePacket(gamemode, getOrCreateUniqueID()).sendTo(*this);
 }
 
-void GMLIB_Player::setClientBossbar(
-    int64_t        bossbarId,
-    std::string    name,
-    float          percentage,
-    ::BossBarColor color,
-    int            overlay
-) {
-    // AddActorPacket
-    GMLIB_BinaryStream bs1;
-    bs1.writeVarInt64(bossbarId);
-    bs1.writeUnsignedVarInt64(bossbarId);
-    bs1.writeString("player");
-    bs1.writeVec3(Vec3{getPosition().x, -66.0f, getPosition().z});
-    bs1.writeVec3(Vec3{0, 0, 0});
-    bs1.writeVec2(Vec2{0, 0});
-    bs1.writeFloat(0.0f);
-    bs1.writeFloat(0.0f);
-    bs1.writeUnsignedVarInt(0);
-    bs1.writeUnsignedVarInt(0);
-    bs1.writeUnsignedVarInt(0);
-    bs1.writeUnsignedVarInt(0);
-    bs1.writeUnsignedVarInt(0);
-    GMLIB_NetworkPacket<(int)MinecraftPacketIds::AddActor> pkt1(bs1.getAndReleaseData());
-    pkt1.sendTo(*this);
-    // BossEventPacket
-    GMLIB_BinaryStream bs2;
-    bs2.mBuffer->reserve(8 + name.size());
-    bs2.writeVarInt64(bossbarId);
-    bs2.writeUnsignedVarInt(0);
-    bs2.writeString(name);
-    bs2.writeFloat(percentage);
-    bs2.writeUnsignedShort(1);
-    bs2.writeUnsignedVarInt((int)color);
-    bs2.writeUnsignedVarInt(overlay);
-    auto pkt2 = MinecraftPackets::createPacket(MinecraftPacketIds::BossEvent);
-    pkt2->read(bs2);
-    pkt2->sendTo(*this);
-}
-
-int64_t GMLIB_Player::setClientBossbar(std::string name, float percentage, ::BossBarColor color, int overlay) {
-    auto bossbarId = GMLIB_Actor::getNextActorUniqueID();
-    setClientBossbar(bossbarId, name, percentage, color, overlay);
-    return bossbarId;
-}
-
-void GMLIB_Player::removeClientBossbar(int64_t bossbarId) {
-    GMLIB_BinaryStream bs;
-    bs.writeVarInt64(bossbarId);
-    bs.writeUnsignedVarInt((int)2);
-    auto pkt = MinecraftPackets::createPacket(MinecraftPacketIds::BossEvent);
-    pkt->read(bs);
-    pkt->sendTo(*this);
-}
-
-void GMLIB_Player::updateClientBossbar(
-    int64_t        bossbarId,
-    std::string    name,
-    float          percentage,
-    ::BossBarColor color,
-    int            overlay
-) {
-    removeClientBossbar(bossbarId);
-    setClientBossbar(bossbarId, name, percentage, color, overlay);
-}
-
 void GMLIB_Player::addEffect(
     MobEffect::EffectType effectType,
     int                   duration,
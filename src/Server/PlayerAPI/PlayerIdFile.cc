@@ -0,0 +1,88 @@
+#include "Server/PlayerAPI/PlayerIdFile.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace GMLIB::PlayerAPI {
+
+bool PlayerIdFile::read(
+    std::filesystem::path const&              path,
+    std::string_view                          levelName,
+    std::unordered_map<std::string, int64_t>& ids
+) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    Header            header;
+    if (data.size() < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    size_t offset = sizeof(header);
+    if (header.mMagic != MAGIC || header.mVersion != VERSION || header.mLevelNameSize > data.size() - offset
+        || std::string_view(data.data() + offset, header.mLevelNameSize) != levelName) {
+        return false;
+    }
+    offset += header.mLevelNameSize;
+    std::unordered_map<std::string, int64_t> result;
+    // Each record takes at least 10 bytes, a damaged count must not reserve more than the file can hold.
+    result.reserve(std::min<size_t>(header.mRecordCount, data.size() / 10));
+    for (uint32_t i = 0; i < header.mRecordCount; i++) {
+        uint16_t size;
+        int64_t  uniqueId;
+        if (data.size() - offset < sizeof(size)) {
+            return false;
+        }
+        std::memcpy(&size, data.data() + offset, sizeof(size));
+        offset += sizeof(size);
+        if (data.size() - offset < (size_t)size + sizeof(uniqueId)) {
+            return false;
+        }
+        std::string serverId(data.data() + offset, size);
+        offset += size;
+        std::memcpy(&uniqueId, data.data() + offset, sizeof(uniqueId));
+        offset += sizeof(uniqueId);
+        result.insert_or_assign(std::move(serverId), uniqueId);
+    }
+    ids.merge(result);
+    return true;
+}
+
+bool PlayerIdFile::write(
+    std::filesystem::path const&                    path,
+    std::string_view                                levelName,
+    std::unordered_map<std::string, int64_t> const& ids
+) {
+    std::string data;
+    Header      header{MAGIC, VERSION, (uint32_t)levelName.size(), 0};
+    data.resize(sizeof(header));
+    data.append(levelName);
+    for (auto& [serverId, uniqueId] : ids) {
+        if (serverId.size() > UINT16_MAX) {
+            continue;
+        }
+        auto size = (uint16_t)serverId.size();
+        data.append((char const*)&size, sizeof(size));
+        data.append(serverId);
+        data.append((char const*)&uniqueId, sizeof(uniqueId));
+        header.mRecordCount++;
+    }
+    std::memcpy(data.data(), &header, sizeof(header));
+    auto temp = path;
+    temp += ".tmp";
+    {
+        std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+        if (!file.write(data.data(), (std::streamsize)data.size()) || !file.flush()) {
+            return false;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temp, path, error);
+    return !error;
+}
+
+} // namespace GMLIB::PlayerAPI
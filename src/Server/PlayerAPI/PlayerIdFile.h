@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Engine independent. Persisted serverId -> UniqueID entries, so that offline score lookups after a restart do not
+// read player NBT either.
+//
+// Layout (little endian):
+//   Header
+//   char[mLevelNameSize]           the level the ids belong to
+//   mRecordCount x { uint16 serverId size, char[size] serverId, int64 UniqueID }
+namespace GMLIB::PlayerAPI {
+
+class PlayerIdFile {
+public:
+    static constexpr uint32_t MAGIC   = 0x49534d47; // "GMSI"
+    static constexpr uint32_t VERSION = 1;
+
+    struct Header {
+        uint32_t mMagic;
+        uint32_t mVersion;
+        uint32_t mLevelNameSize;
+        uint32_t mRecordCount;
+    };
+
+public:
+    // Fails on a missing, truncated or foreign file, and on a file written for another level.
+    static bool
+    read(std::filesystem::path const& path, std::string_view levelName, std::unordered_map<std::string, int64_t>& ids);
+
+    // Replaces the file only once the new one is completely written.
+    static bool write(
+        std::filesystem::path const&                    path,
+        std::string_view                                levelName,
+        std::unordered_map<std::string, int64_t> const& ids
+    );
+};
+
+} // namespace GMLIB::PlayerAPI
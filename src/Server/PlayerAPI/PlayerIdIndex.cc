@@ -0,0 +1,155 @@
+#include "Server/PlayerAPI/KeyedTaskQueue.h"
+#include "Server/PlayerAPI/NbtScanner.h"
+#include "Server/PlayerAPI/PlayerIdFile.h"
+#include "Server/PlayerAPI/PlayerIdIndex.h"
+#include <shared_mutex>
+
+namespace GMLIB::PlayerAPI {
+
+constexpr auto PLAYER_ID_FILE_NAME     = "gmlib_uniqueids.bin"; // In the world directory
+constexpr auto PLAYER_ID_TASK_KEY      = "gmlib:uniqueids";
+constexpr uint PLAYER_ID_SAVE_INTERVAL = 20; // Ticks between writes of invalidated entries
+
+// AsyncNbt.cc, the file is written on its workers.
+extern KeyedTaskQueue mAsyncNbtQueue;
+
+std::shared_mutex                                     mPlayerIdMutex;
+std::unordered_map<std::string, std::string>          mServerIds; // Empty for unknown uuids
+std::unordered_map<std::string, std::optional<int64>> mUniqueIds;
+std::string                                           mPlayerIdLevelName;
+std::filesystem::path                                 mPlayerIdFilePath;
+std::atomic<bool>                                     mUniqueIdsChanged     = false; // Since the file was written
+std::atomic<bool>                                     mUniqueIdsInvalidated = false; // Stale entries still in the file
+uint                                                  mPlayerIdSaveTick     = 0;
+
+std::string getServerId(mce::UUID const& uuid) {
+    auto key = uuid.asString();
+    {
+        std::shared_lock lock(mPlayerIdMutex);
+        if (auto it = mServerIds.find(key); it != mServerIds.end()) {
+            return it->second;
+        }
+    }
+    std::string serverId;
+    std::string buffer;
+    if (GMLIB::Global<DBStorage>->loadData("player_" + key, buffer, DBHelpers::Category::Player)) {
+        serverId = NbtScanner::getString(buffer, "ServerId").value_or("");
+    }
+    std::unique_lock lock(mPlayerIdMutex);
+    mServerIds.try_emplace(std::move(key), serverId);
+    return serverId;
+}
+
+std::optional<int64> getUniqueId(std::string const& serverId) {
+    if (serverId.empty()) {
+        return {};
+    }
+    {
+        std::shared_lock lock(mPlayerIdMutex);
+        if (auto it = mUniqueIds.find(serverId); it != mUniqueIds.end()) {
+            return it->second;
+        }
+    }
+    std::optional<int64> uniqueId;
+    std::string          buffer;
+    if (GMLIB::Global<DBStorage>->loadData(serverId, buffer, DBHelpers::Category::Player)) {
+        uniqueId = NbtScanner::getInt64(buffer, "UniqueID");
+    }
+    std::unique_lock lock(mPlayerIdMutex);
+    if (mUniqueIds.try_emplace(serverId, uniqueId).second && uniqueId) {
+        mUniqueIdsChanged = true;
+    }
+    return uniqueId;
+}
+
+void updatePlayerIds(Player& player) {
+    auto serverId = player.getServerId();
+    if (serverId.empty()) {
+        return;
+    }
+    auto             uniqueId = player.getOrCreateUniqueID().id;
+    std::unique_lock lock(mPlayerIdMutex);
+    mServerIds.insert_or_assign(player.getUuid().asString(), serverId);
+    auto [it, inserted] = mUniqueIds.try_emplace(serverId, uniqueId);
+    if (inserted || it->second != uniqueId) {
+        it->second        = uniqueId;
+        mUniqueIdsChanged = true;
+    }
+}
+
+void invalidateServerId(std::string const& serverId) {
+    std::unique_lock lock(mPlayerIdMutex);
+    if (mUniqueIds.erase(serverId)) {
+        mUniqueIdsChanged     = true;
+        mUniqueIdsInvalidated = true;
+    }
+}
+
+void initPlayerIdIndex() {
+    auto level         = ll::service::bedrock::getLevel();
+    mPlayerIdLevelName = level->getLevelData().getLevelName();
+    auto worldPath     = std::filesystem::path(level->getLevelStorage().getFullPath().getContainer());
+    mPlayerIdFilePath  = worldPath / PLAYER_ID_FILE_NAME;
+    std::unordered_map<std::string, int64_t> ids;
+    if (PlayerIdFile::read(mPlayerIdFilePath, mPlayerIdLevelName, ids)) {
+        std::unique_lock lock(mPlayerIdMutex);
+        for (auto& [serverId, uniqueId] : ids) {
+            mUniqueIds.try_emplace(serverId, uniqueId);
+        }
+    } else if (std::filesystem::exists(mPlayerIdFilePath)) {
+        // Copied from another level or damaged, rebuilt by the lookups from now on.
+        mUniqueIdsChanged = true;
+    }
+    ll::event::EventBus::getInstance().emplaceListener<ll::event::PlayerJoinEvent>(
+        [](ll::event::PlayerJoinEvent& event) { updatePlayerIds(event.self()); }
+    );
+    // The player is saved when leaving.
+    ll::event::EventBus::getInstance().emplaceListener<ll::event::PlayerLeaveEvent>(
+        [](ll::event::PlayerLeaveEvent& event) { updatePlayerIds(event.self()); }
+    );
+}
+
+void writePlayerIdFile() {
+    mUniqueIdsInvalidated = false;
+    if (!mUniqueIdsChanged.exchange(false)) {
+        return;
+    }
+    // Unknown players are not persisted, they may have joined by the next start.
+    std::unordered_map<std::string, int64_t> ids;
+    {
+        std::shared_lock lock(mPlayerIdMutex);
+        ids.reserve(mUniqueIds.size());
+        for (auto& [serverId, uniqueId] : mUniqueIds) {
+            if (uniqueId) {
+                ids.emplace(serverId, *uniqueId);
+            }
+        }
+    }
+    if (!PlayerIdFile::write(mPlayerIdFilePath, mPlayerIdLevelName, ids)) {
+        logger.error("Failed to write {}", mPlayerIdFilePath.string());
+    }
+}
+
+// Takes its snapshot when it runs, so a queued save also covers the saves submitted after it.
+class SavePlayerIdsTask : public KeyedTask {
+public:
+    void run() override { writePlayerIdFile(); }
+
+    bool merge(KeyedTask& next) override { return dynamic_cast<SavePlayerIdsTask*>(&next) != nullptr; }
+};
+
+// Once AsyncNbt is stopped the file is written on the calling thread.
+void savePlayerIdIndex() { mAsyncNbtQueue.submit(PLAYER_ID_TASK_KEY, std::make_shared<SavePlayerIdsTask>()); }
+
+// New entries can wait for the next save, but a removed one must not come back from the file after a crash.
+void processPlayerIdIndex() {
+    if (++mPlayerIdSaveTick < PLAYER_ID_SAVE_INTERVAL) {
+        return;
+    }
+    mPlayerIdSaveTick = 0;
+    if (mUniqueIdsInvalidated) {
+        savePlayerIdIndex();
+    }
+}
+
+} // namespace GMLIB::PlayerAPI
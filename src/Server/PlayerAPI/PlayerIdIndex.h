@@ -0,0 +1,18 @@
+#pragma once
+#include "Global.h"
+
+// Caches uuid -> serverId and serverId -> UniqueID, which otherwise cost a LevelDB read and a full NBT decode
+// per offline lookup. Misses are cached as well, joining and leaving players refresh their entries.
+// Known UniqueIDs are kept in a file in the world directory, so that they survive restarts.
+namespace GMLIB::PlayerAPI {
+
+extern std::string getServerId(mce::UUID const& uuid);
+
+extern std::optional<int64> getUniqueId(std::string const& serverId);
+
+extern void updatePlayerIds(Player& player);
+
+// Called whenever the stored NBT of serverId is replaced or deleted.
+extern void invalidateServerId(std::string const& serverId);
+
+} // namespace GMLIB::PlayerAPI
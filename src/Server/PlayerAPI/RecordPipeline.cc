@@ -0,0 +1,106 @@
+#include "Server/PlayerAPI/RecordPipeline.h"
+#include <algorithm>
+
+namespace GMLIB::PlayerAPI {
+
+RecordPipeline::RecordPipeline(Visitor visitor, uint32_t workerCount, size_t batchSize, size_t queueCapacity)
+: mVisitor(std::move(visitor)),
+  mWorkerCount(workerCount),
+  mBatchSize(std::max<size_t>(batchSize, 1)),
+  mQueueCapacity(queueCapacity ? queueCapacity : (size_t)workerCount * 2) {
+    for (uint32_t i = 0; i < mWorkerCount; i++) {
+        mWorkers.emplace_back([this, i] { run(i); });
+    }
+}
+
+RecordPipeline::~RecordPipeline() { finish(); }
+
+uint32_t RecordPipeline::resolveWorkerCount(uint32_t requested) {
+    if (requested) {
+        return requested;
+    }
+    auto cores = std::thread::hardware_concurrency();
+    return cores > 1 ? cores - 1 : 1;
+}
+
+uint32_t RecordPipeline::getWorkerCount() const { return std::max<uint32_t>(mWorkerCount, 1); }
+
+size_t RecordPipeline::getFailedCount() const { return mFailedCount; }
+
+void RecordPipeline::push(std::string_view key, std::string_view value) {
+    auto keyOffset = (uint32_t)mCurrent.mBuffer.size();
+    mCurrent.mBuffer.append(key);
+    auto valueOffset = (uint32_t)mCurrent.mBuffer.size();
+    mCurrent.mBuffer.append(value);
+    mCurrent.mKeys.emplace_back(keyOffset, (uint32_t)key.size());
+    mCurrent.mValues.emplace_back(valueOffset, (uint32_t)value.size());
+    if (mCurrent.mKeys.size() >= mBatchSize) {
+        flushBatch();
+    }
+}
+
+void RecordPipeline::flushBatch() {
+    if (mCurrent.mKeys.empty()) {
+        return;
+    }
+    if (mWorkerCount == 0) {
+        process(0, mCurrent);
+    } else {
+        std::unique_lock lock(mMutex);
+        mNotFull.wait(lock, [this] { return mQueue.size() < mQueueCapacity; });
+        mQueue.push_back(std::move(mCurrent));
+        lock.unlock();
+        mNotEmpty.notify_one();
+    }
+    mCurrent = {};
+}
+
+void RecordPipeline::finish() {
+    flushBatch();
+    {
+        std::lock_guard lock(mMutex);
+        if (mFinished) {
+            return;
+        }
+        mFinished = true;
+    }
+    mNotEmpty.notify_all();
+    for (auto& worker : mWorkers) {
+        worker.join();
+    }
+    mWorkers.clear();
+}
+
+void RecordPipeline::run(uint32_t workerIndex) {
+    while (true) {
+        Batch batch;
+        {
+            std::unique_lock lock(mMutex);
+            mNotEmpty.wait(lock, [this] { return mFinished || !mQueue.empty(); });
+            if (mQueue.empty()) {
+                return;
+            }
+            batch = std::move(mQueue.front());
+            mQueue.pop_front();
+        }
+        mNotFull.notify_one();
+        process(workerIndex, batch);
+    }
+}
+
+void RecordPipeline::process(uint32_t workerIndex, Batch const& batch) {
+    std::string_view buffer = batch.mBuffer;
+    for (size_t i = 0; i < batch.mKeys.size(); i++) {
+        try {
+            mVisitor(
+                workerIndex,
+                buffer.substr(batch.mKeys[i].first, batch.mKeys[i].second),
+                buffer.substr(batch.mValues[i].first, batch.mValues[i].second)
+            );
+        } catch (...) {
+            mFailedCount++;
+        }
+    }
+}
+
+} // namespace GMLIB::PlayerAPI
@@ -0,0 +1,75 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Engine independent. Hands key/value records from one producer thread to a pool of workers.
+namespace GMLIB::PlayerAPI {
+
+class RecordPipeline {
+public:
+    // Called on a worker thread, workerIndex is in [0, getWorkerCount()).
+    using Visitor = std::function<void(uint32_t workerIndex, std::string_view key, std::string_view value)>;
+
+private:
+    // Records are copied into one buffer per batch, so that a batch costs one allocation.
+    struct Batch {
+        std::string                                mBuffer;
+        std::vector<std::pair<uint32_t, uint32_t>> mKeys;
+        std::vector<std::pair<uint32_t, uint32_t>> mValues;
+    };
+
+    Visitor                  mVisitor;
+    uint32_t                 mWorkerCount;
+    size_t                   mBatchSize;
+    size_t                   mQueueCapacity;
+    Batch                    mCurrent;
+    std::mutex               mMutex;
+    std::condition_variable  mNotEmpty;
+    std::condition_variable  mNotFull;
+    std::deque<Batch>        mQueue;
+    bool                     mFinished = false;
+    std::vector<std::thread> mWorkers;
+    std::atomic<size_t>      mFailedCount = 0;
+
+public:
+    // workerCount 0 runs every record on the producer thread.
+    RecordPipeline(Visitor visitor, uint32_t workerCount, size_t batchSize = 64, size_t queueCapacity = 0);
+
+    RecordPipeline(RecordPipeline const&)            = delete;
+    RecordPipeline& operator=(RecordPipeline const&) = delete;
+
+    ~RecordPipeline();
+
+public:
+    // Producer side, blocks while the queue is full.
+    void push(std::string_view key, std::string_view value);
+
+    // Processes the remaining records and joins the workers.
+    void finish();
+
+    uint32_t getWorkerCount() const;
+
+    // Records whose visitor threw.
+    size_t getFailedCount() const;
+
+public:
+    // 0 picks one worker per core besides the producer.
+    static uint32_t resolveWorkerCount(uint32_t requested);
+
+private:
+    void run(uint32_t workerIndex);
+
+    void process(uint32_t workerIndex, Batch const& batch);
+
+    void flushBatch();
+};
+
+} // namespace GMLIB::PlayerAPI
@@ -0,0 +1,164 @@
+#include "Server/PlayerAPI/SidebarAPI.h"
+#include "Server/PlayerAPI/PacketQueueAPI.h"
+#include <GMLIB/Server/BinaryStreamAPI.h>
+#include <GMLIB/Server/NetworkPacketAPI.h>
+#include <GMLIB/Server/PlayerAPI.h>
+
+namespace GMLIB::PlayerAPI {
+
+// Updates are kept until the end of the tick, only the last one of a tick is diffed and sent.
+struct PlayerSidebar {
+    mce::UUID                    mUuid;
+    SidebarState                 mState;
+    std::optional<SidebarUpdate> mPending;
+    bool                         mRemovePending = false;
+    bool                         mDirty         = false;
+};
+
+std::unordered_map<std::string, PlayerSidebar> mPlayerSidebars;
+std::vector<std::string>                       mDirtySidebars;
+SidebarStatistics                              mSidebarStatistics;
+
+std::string encodeSidebarDisplay(std::string_view objective, std::string_view title, int sortOrder) {
+    GMLIB_BinaryStream bs;
+    bs.writeString("sidebar");
+    bs.writeString(objective);
+    bs.writeString(title);
+    bs.writeString("dummy");
+    bs.writeVarInt(sortOrder);
+    return bs.getAndReleaseData();
+}
+
+std::string encodeSidebarScores(std::vector<SidebarState::Entry> const& entries, bool remove) {
+    GMLIB_BinaryStream bs;
+    bs.writeUnsignedChar(remove ? (uchar)ScorePacketType::Remove : (uchar)ScorePacketType::Change);
+    bs.writeUnsignedVarInt((uint)entries.size());
+    for (auto& entry : entries) {
+        bs.writeVarInt64(entry.mId);
+        bs.writeString(SIDEBAR_OBJECTIVE);
+        bs.writeSignedInt(entry.mScore);
+        if (!remove) {
+            bs.writeUnsignedChar((uchar)IdentityDefinition::Type::FakePlayer);
+            bs.writeString(entry.mText);
+        }
+    }
+    return bs.getAndReleaseData();
+}
+
+void sendSidebarDisplay(Player& player, std::string const& data) {
+    sendPlayerPacket(player, (int)MinecraftPacketIds::SetDisplayObjective, data);
+    mSidebarStatistics.mPackets++;
+    mSidebarStatistics.mBytes += data.size();
+}
+
+void sendSidebarScores(Player& player, std::string const& data) {
+    sendPlayerPacket(player, (int)MinecraftPacketIds::SetScore, data);
+    mSidebarStatistics.mPackets++;
+    mSidebarStatistics.mBytes += data.size();
+}
+
+void sendSidebarDiff(Player& player, SidebarState::Diff const& diff, std::string_view title, int sortOrder) {
+    if (diff.mDisplay) {
+        sendSidebarDisplay(player, encodeSidebarDisplay(SIDEBAR_OBJECTIVE, title, sortOrder));
+    }
+    if (!diff.mRemoved.empty()) {
+        sendSidebarScores(player, encodeSidebarScores(diff.mRemoved, true));
+    }
+    if (!diff.mChanged.empty()) {
+        sendSidebarScores(player, encodeSidebarScores(diff.mChanged, false));
+    }
+}
+
+void countSidebarUpdate() { mSidebarStatistics.mUpdates++; }
+
+PlayerSidebar& getPlayerSidebar(Player& player) {
+    auto  uuid    = player.getUuid();
+    auto& sidebar = mPlayerSidebars[uuid.asString()];
+    sidebar.mUuid = uuid;
+    if (!sidebar.mDirty) {
+        sidebar.mDirty = true;
+        mDirtySidebars.push_back(uuid.asString());
+    }
+    return sidebar;
+}
+
+void resetPlayerSidebar(Player& player) {
+    auto& sidebar          = getPlayerSidebar(player);
+    sidebar.mRemovePending = false;
+    sidebar.mPending.reset();
+    sidebar.mState.clear();
+}
+
+void hidePlayerSidebar(Player& player) {
+    auto& sidebar          = getPlayerSidebar(player);
+    sidebar.mRemovePending = true;
+    sidebar.mPending.reset();
+}
+
+void processSidebars() {
+    processSidebarChannels();
+    if (mDirtySidebars.empty()) {
+        return;
+    }
+    auto level = ll::service::getLevel();
+    for (auto& key : mDirtySidebars) {
+        auto it = mPlayerSidebars.find(key);
+        if (it == mPlayerSidebars.end()) {
+            continue;
+        }
+        auto& sidebar  = it->second;
+        sidebar.mDirty = false;
+        auto player    = level ? level->getPlayer(sidebar.mUuid) : nullptr;
+        if (!player) {
+            mPlayerSidebars.erase(it);
+            continue;
+        }
+        if (sidebar.mRemovePending) {
+            sidebar.mRemovePending = false;
+            sidebar.mState.clear();
+            sendSidebarDisplay(*player, encodeSidebarDisplay("", "", 0));
+            countSidebarUpdate();
+        }
+        if (sidebar.mPending) {
+            auto update = std::move(*sidebar.mPending);
+            sidebar.mPending.reset();
+            auto diff = sidebar.mState.update(update.mTitle, update.mLines, update.mSortOrder);
+            if (!diff.empty()) {
+                sendSidebarDiff(*player, diff, update.mTitle, update.mSortOrder);
+                countSidebarUpdate();
+            }
+        }
+    }
+    mDirtySidebars.clear();
+}
+
+void initSidebars() {
+    ll::event::EventBus::getInstance().emplaceListener<ll::event::PlayerLeaveEvent>(
+        [](ll::event::PlayerLeaveEvent& event) {
+            leaveSidebarChannel(event.self());
+            mPlayerSidebars.erase(event.self().getUuid().asString());
+        }
+    );
+}
+
+} // namespace GMLIB::PlayerAPI
+
+void GMLIB_Player::setClientSidebar(
+    const std::string                               title,
+    const std::vector<std::pair<std::string, int>>& data,
+    ObjectiveSortOrder                              sortOrder
+) {
+    GMLIB::PlayerAPI::leaveSidebarChannel(*this);
+    auto& sidebar          = GMLIB::PlayerAPI::getPlayerSidebar(*this);
+    sidebar.mRemovePending = false;
+    sidebar.mPending       = {title, data, (int)sortOrder};
+}
+
+void GMLIB_Player::removeClientSidebar() {
+    GMLIB::PlayerAPI::leaveSidebarChannel(*this);
+    GMLIB::PlayerAPI::hidePlayerSidebar(*this);
+}
+
+SidebarStatistics GMLIB_Player::getSidebarStatistics() { return GMLIB::PlayerAPI::mSidebarStatistics; }
+
+void GMLIB_Player::resetSidebarStatistics() { GMLIB::PlayerAPI::mSidebarStatistics = {}; }
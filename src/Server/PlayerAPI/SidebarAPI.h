@@ -0,0 +1,40 @@
+#pragma once
+#include "Global.h"
+#include "Server/PlayerAPI/SidebarState.h"
+
+// Sidebar packets are encoded by hand, so that one encoding can be sent to any number of players.
+namespace GMLIB::PlayerAPI {
+
+constexpr std::string_view SIDEBAR_OBJECTIVE = "GMLIB_SIDEBAR_API";
+
+struct SidebarUpdate {
+    std::string                              mTitle;
+    std::vector<std::pair<std::string, int>> mLines;
+    int                                      mSortOrder;
+};
+
+// An empty objective hides the sidebar.
+extern std::string encodeSidebarDisplay(std::string_view objective, std::string_view title, int sortOrder);
+
+extern std::string encodeSidebarScores(std::vector<SidebarState::Entry> const& entries, bool remove);
+
+extern void sendSidebarDisplay(Player& player, std::string const& data);
+
+extern void sendSidebarScores(Player& player, std::string const& data);
+
+// Sends diff in at most one display and two score packets.
+extern void sendSidebarDiff(Player& player, SidebarState::Diff const& diff, std::string_view title, int sortOrder);
+
+extern void countSidebarUpdate();
+
+// Drops the sidebar state of a player, whose sidebar is now shown by a channel.
+extern void resetPlayerSidebar(Player& player);
+
+// Hides the sidebar at the end of the tick.
+extern void hidePlayerSidebar(Player& player);
+
+extern void leaveSidebarChannel(Player& player);
+
+extern void processSidebarChannels();
+
+} // namespace GMLIB::PlayerAPI
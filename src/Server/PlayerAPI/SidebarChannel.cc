@@ -0,0 +1,257 @@
+#include "Server/PlayerAPI/SidebarAPI.h"
+#include <GMLIB/Server/SidebarAPI.h>
+
+namespace GMLIB::PlayerAPI {
+
+class SidebarChannelImpl;
+
+std::unordered_set<SidebarChannelImpl*>              mSidebarChannels;
+std::unordered_map<std::string, SidebarChannelImpl*> mPlayerChannels; // By uuid
+
+class SidebarChannelImpl : public SidebarChannel {
+public:
+    struct Subscriber {
+        mce::UUID                                                    mUuid;
+        bool                                                         mJoined = true; // Needs the whole sidebar
+        std::unordered_map<std::string, std::pair<std::string, int>> mOverrides;     // By the text of the shared line
+        std::unordered_map<std::string, SidebarState::Entry>         mShownOverrides;
+    };
+
+    SidebarState                                mState;
+    std::optional<SidebarUpdate>                mPending;
+    std::unordered_map<std::string, Subscriber> mSubscribers; // By uuid
+    bool                                        mDirty = false;
+
+public:
+    SidebarChannelImpl() { mSidebarChannels.insert(this); }
+
+    ~SidebarChannelImpl() override {
+        mSidebarChannels.erase(this);
+        auto level = ll::service::getLevel();
+        for (auto& [key, subscriber] : mSubscribers) {
+            mPlayerChannels.erase(key);
+            if (auto player = level ? level->getPlayer(subscriber.mUuid) : nullptr) {
+                hidePlayerSidebar(*player);
+            }
+        }
+    }
+
+public:
+    void subscribe(Player& player) override {
+        auto key = player.getUuid().asString();
+        if (mSubscribers.contains(key)) {
+            return;
+        }
+        leaveSidebarChannel(player);
+        resetPlayerSidebar(player);
+        mSubscribers[key].mUuid = player.getUuid();
+        mPlayerChannels[key]    = this;
+        mDirty                  = true;
+    }
+
+    void unsubscribe(Player& player) override {
+        if (mSubscribers.erase(player.getUuid().asString())) {
+            mPlayerChannels.erase(player.getUuid().asString());
+            hidePlayerSidebar(player);
+        }
+    }
+
+    bool isSubscribed(Player& player) const override { return mSubscribers.contains(player.getUuid().asString()); }
+
+    size_t getSubscriberCount() const override { return mSubscribers.size(); }
+
+    void setSidebar(
+        std::string const&                              title,
+        std::vector<std::pair<std::string, int>> const& data,
+        ObjectiveSortOrder                              sortOrder
+    ) override {
+        mPending = {title, data, (int)sortOrder};
+        mDirty   = true;
+    }
+
+    void setPlayerLine(Player& player, std::string const& lineText, std::string const& text, int score) override {
+        auto it = mSubscribers.find(player.getUuid().asString());
+        if (it != mSubscribers.end()) {
+            it->second.mOverrides.insert_or_assign(lineText, std::pair{text, score});
+            mDirty = true;
+        }
+    }
+
+    void resetPlayerLine(Player& player, std::string const& lineText) override {
+        auto it = mSubscribers.find(player.getUuid().asString());
+        if (it != mSubscribers.end() && it->second.mOverrides.erase(lineText)) {
+            mDirty = true;
+        }
+    }
+
+    void resetPlayerLines(Player& player) override {
+        auto it = mSubscribers.find(player.getUuid().asString());
+        if (it != mSubscribers.end() && !it->second.mOverrides.empty()) {
+            it->second.mOverrides.clear();
+            mDirty = true;
+        }
+    }
+
+public:
+    void process() {
+        if (!mDirty) {
+            return;
+        }
+        mDirty = false;
+        SidebarState::Diff diff;
+        if (mPending) {
+            diff = mState.update(mPending->mTitle, mPending->mLines, mPending->mSortOrder);
+            mPending.reset();
+        }
+        if (!mState.isShown()) {
+            return;
+        }
+        // Shared packets, encoded once for every subscriber.
+        std::string display;
+        std::string removed;
+        std::string changed;
+        std::string fullChanged;
+        if (diff.mDisplay) {
+            display = encodeSidebarDisplay(SIDEBAR_OBJECTIVE, mState.getTitle(), mState.getSortOrder());
+        }
+        if (!diff.mRemoved.empty()) {
+            removed = encodeSidebarScores(diff.mRemoved, true);
+        }
+        if (!diff.mChanged.empty()) {
+            changed = encodeSidebarScores(diff.mChanged, false);
+        }
+        std::unordered_set<std::string_view> changedTexts;
+        for (auto& entry : diff.mChanged) {
+            changedTexts.insert(entry.mText);
+        }
+        auto level = ll::service::getLevel();
+        for (auto it = mSubscribers.begin(); it != mSubscribers.end();) {
+            auto& subscriber = it->second;
+            auto  player     = level ? level->getPlayer(subscriber.mUuid) : nullptr;
+            if (!player) {
+                mPlayerChannels.erase(it->first);
+                it = mSubscribers.erase(it);
+                continue;
+            }
+            bool reset = subscriber.mJoined || diff.mDisplay;
+            if (subscriber.mJoined && !diff.mDisplay) {
+                // Players joining later get the whole sidebar, also encoded once.
+                if (display.empty()) {
+                    display = encodeSidebarDisplay(SIDEBAR_OBJECTIVE, mState.getTitle(), mState.getSortOrder());
+                }
+                if (fullChanged.empty()) {
+                    std::vector<SidebarState::Entry> entries;
+                    for (auto& [key, entry] : mState.getEntries()) {
+                        entries.push_back(entry);
+                    }
+                    fullChanged = encodeSidebarScores(entries, false);
+                }
+                sendSidebarDisplay(*player, display);
+                sendSidebarScores(*player, fullChanged);
+            } else {
+                if (diff.mDisplay) {
+                    sendSidebarDisplay(*player, display);
+                }
+                if (!removed.empty()) {
+                    sendSidebarScores(*player, removed);
+                }
+                if (!changed.empty()) {
+                    sendSidebarScores(*player, changed);
+                }
+            }
+            subscriber.mJoined = false;
+            if (!subscriber.mOverrides.empty() || !subscriber.mShownOverrides.empty()) {
+                applyOverrides(*player, subscriber, reset, changedTexts);
+            }
+            if (reset || !diff.empty()) {
+                countSidebarUpdate();
+            }
+            it++;
+        }
+    }
+
+    // Only the lines a player sees differently are sent to that player alone.
+    void applyOverrides(
+        Player&                                     player,
+        Subscriber&                                 subscriber,
+        bool                                        reset,
+        std::unordered_set<std::string_view> const& changedTexts
+    ) {
+        auto&                            lines = mState.getEntries();
+        std::vector<SidebarState::Entry> removed;
+        std::vector<SidebarState::Entry> changed;
+        if (reset) {
+            // The client dropped every line.
+            subscriber.mShownOverrides.clear();
+        }
+        for (auto it = subscriber.mShownOverrides.begin(); it != subscriber.mShownOverrides.end();) {
+            auto line = lines.find({it->first, 0});
+            if (line != lines.end() && subscriber.mOverrides.contains(it->first)) {
+                it++;
+                continue;
+            }
+            removed.push_back(it->second);
+            if (line != lines.end() && !changedTexts.contains(it->first)) {
+                // The shared line was hidden, show it again.
+                changed.push_back(line->second);
+            }
+            it = subscriber.mShownOverrides.erase(it);
+        }
+        for (auto& [lineText, value] : subscriber.mOverrides) {
+            auto line = lines.find({lineText, 0});
+            if (line == lines.end()) {
+                continue;
+            }
+            auto& [text, score] = value;
+            auto  shown         = subscriber.mShownOverrides.find(lineText);
+            if (shown == subscriber.mShownOverrides.end()) {
+                removed.push_back(line->second);
+                auto& entry = subscriber.mShownOverrides[lineText] = {SidebarState::allocateId(), text, score};
+                changed.push_back(entry);
+                continue;
+            }
+            if (changedTexts.contains(lineText)) {
+                // The shared packet has shown the line again.
+                removed.push_back(line->second);
+            }
+            auto& entry = shown->second;
+            if (entry.mText != text) {
+                removed.push_back(entry);
+                entry = {SidebarState::allocateId(), text, score};
+                changed.push_back(entry);
+            } else if (entry.mScore != score) {
+                entry.mScore = score;
+                changed.push_back(entry);
+            }
+        }
+        if (!removed.empty()) {
+            sendSidebarScores(player, encodeSidebarScores(removed, true));
+        }
+        if (!changed.empty()) {
+            sendSidebarScores(player, encodeSidebarScores(changed, false));
+        }
+    }
+
+    void leave(std::string const& key) { mSubscribers.erase(key); }
+};
+
+void leaveSidebarChannel(Player& player) {
+    auto key = player.getUuid().asString();
+    auto it  = mPlayerChannels.find(key);
+    if (it != mPlayerChannels.end()) {
+        it->second->leave(key);
+        mPlayerChannels.erase(it);
+    }
+}
+
+void processSidebarChannels() {
+    for (auto channel : mSidebarChannels) {
+        channel->process();
+    }
+}
+
+} // namespace GMLIB::PlayerAPI
+
+std::shared_ptr<SidebarChannel> SidebarChannel::create() {
+    return std::make_shared<GMLIB::PlayerAPI::SidebarChannelImpl>();
+}
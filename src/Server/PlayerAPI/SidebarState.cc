@@ -0,0 +1,65 @@
+#include "Server/PlayerAPI/SidebarState.h"
+#include <atomic>
+
+namespace GMLIB::PlayerAPI {
+
+constexpr int64_t SIDEBAR_ID_BASE = -2;
+
+int64_t SidebarState::allocateId() {
+    static std::atomic<int64_t> nextId = SIDEBAR_ID_BASE;
+    return nextId--;
+}
+
+SidebarState::Diff
+SidebarState::update(std::string_view title, std::vector<std::pair<std::string, int>> const& lines, int sortOrder) {
+    Diff diff;
+    diff.mDisplay = !mShown || mTitle != title || mSortOrder != sortOrder;
+    EntryMap                                     entries;
+    std::unordered_map<std::string_view, size_t> occurrences;
+    entries.reserve(lines.size());
+    for (auto& [text, score] : lines) {
+        LineKey key{text, occurrences[text]++};
+        if (entries.contains(key)) {
+            continue;
+        }
+        auto it = mEntries.find(key);
+        if (it == mEntries.end()) {
+            auto& entry = entries.emplace(std::move(key), Entry{allocateId(), text, score}).first->second;
+            diff.mChanged.push_back(entry);
+            continue;
+        }
+        auto& entry = entries.emplace(std::move(key), std::move(it->second)).first->second;
+        mEntries.erase(it);
+        if (diff.mDisplay || entry.mScore != score) {
+            entry.mScore = score;
+            diff.mChanged.push_back(entry);
+        }
+    }
+    // Displaying the objective again drops the old lines on the client anyway.
+    if (!diff.mDisplay) {
+        for (auto& [key, entry] : mEntries) {
+            diff.mRemoved.push_back(std::move(entry));
+        }
+    }
+    mEntries   = std::move(entries);
+    mShown     = true;
+    mTitle     = title;
+    mSortOrder = sortOrder;
+    return diff;
+}
+
+void SidebarState::clear() {
+    mEntries.clear();
+    mShown = false;
+    mTitle.clear();
+}
+
+bool SidebarState::isShown() const { return mShown; }
+
+std::string const& SidebarState::getTitle() const { return mTitle; }
+
+int SidebarState::getSortOrder() const { return mSortOrder; }
+
+SidebarState::EntryMap const& SidebarState::getEntries() const { return mEntries; }
+
+} // namespace GMLIB::PlayerAPI
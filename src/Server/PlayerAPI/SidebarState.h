@@ -0,0 +1,68 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Engine independent. The sidebar a client currently shows, so that updates only send what changed.
+namespace GMLIB::PlayerAPI {
+
+class SidebarState {
+public:
+    // One line, shown as a fake player named mText.
+    struct Entry {
+        int64_t     mId;
+        std::string mText;
+        int         mScore;
+    };
+
+    // Line text and its occurrence, repeated texts get their own keys so that every line is shown.
+    using LineKey = std::pair<std::string, size_t>;
+
+    struct LineKeyHash {
+        size_t operator()(LineKey const& key) const {
+            return std::hash<std::string>{}(key.first) ^ (key.second * 0x9e3779b97f4a7c15ull);
+        }
+    };
+
+    using EntryMap = std::unordered_map<LineKey, Entry, LineKeyHash>;
+
+    struct Diff {
+        bool               mDisplay = false; // The objective has to be displayed again, mChanged then holds every line
+        std::vector<Entry> mChanged;
+        std::vector<Entry> mRemoved;
+
+        bool empty() const { return !mDisplay && mChanged.empty() && mRemoved.empty(); }
+    };
+
+private:
+    bool        mShown     = false;
+    int         mSortOrder = 0;
+    std::string mTitle;
+    EntryMap    mEntries;
+
+public:
+    // Makes lines the shown state and returns what has to be sent for it.
+    // A line keeps its ScoreboardId as long as its text stays, a score change reuses the id.
+    Diff update(std::string_view title, std::vector<std::pair<std::string, int>> const& lines, int sortOrder);
+
+    // The client no longer shows the sidebar.
+    void clear();
+
+    bool isShown() const;
+
+    std::string const& getTitle() const;
+
+    int getSortOrder() const;
+
+    EntryMap const& getEntries() const;
+
+public:
+    // Ids of the sidebar fake players. They count down from -2, away from the positive ScoreboardIds the server
+    // hands out and from the invalid id -1, and stay short as zigzag varints.
+    static int64_t allocateId();
+};
+
+} // namespace GMLIB::PlayerAPI
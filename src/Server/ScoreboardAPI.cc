@@ -1,7 +1,146 @@
 #include "Global.h"
+#include "Server/PlayerAPI/PlayerIdIndex.h"
+#include "Server/ScoreboardAPI/Leaderboard.h"
+#include "Server/ScoreboardAPI/ScoreCache.h"
+#include <GMLIB/Server/BinaryStreamAPI.h>
+#include <GMLIB/Server/NetworkPacketAPI.h>
 #include <GMLIB/Server/PlayerAPI.h>
 #include <GMLIB/Server/ScoreboardAPI.h>
 
+namespace GMLIB::ScoreboardAPI {
+
+// Kept valid by the ServerScoreboard hooks below.
+ScoreCache                                        mScoreCache;
+std::unordered_map<Objective const*, Leaderboard> mLeaderboards;
+
+// By raw id, for the entries returned. Kept while a leaderboard holds the id.
+struct LeaderboardId {
+    ScoreboardId mId;
+    size_t       mBoards = 0;
+};
+std::unordered_map<int64_t, LeaderboardId> mLeaderboardIds;
+
+// Drops the score packets of one objective while setScores applies its changes. Packets of other objectives, for
+// example raised by other plugins reacting to a change, are still sent.
+class ScoreSyncSuppression {
+public:
+    std::string const&    mObjective;
+    size_t                mPackets = 0;
+    ScoreSyncSuppression* mPrevious;
+
+    explicit ScoreSyncSuppression(std::string const& objective);
+    ~ScoreSyncSuppression();
+
+    bool suppresses(Packet const& packet) const;
+};
+
+ScoreSyncSuppression* mScoreSyncSuppression = nullptr;
+
+ScoreSyncSuppression::ScoreSyncSuppression(std::string const& objective)
+: mObjective(objective),
+  mPrevious(mScoreSyncSuppression) {
+    mScoreSyncSuppression = this;
+}
+
+ScoreSyncSuppression::~ScoreSyncSuppression() { mScoreSyncSuppression = mPrevious; }
+
+bool ScoreSyncSuppression::suppresses(Packet const& packet) const {
+    if (packet.getId() != MinecraftPacketIds::SetScore) {
+        return false;
+    }
+    auto& infos = static_cast<SetScorePacket const&>(packet).mScoreInfo;
+    for (auto& info : infos) {
+        if (info.mObjectiveName != mObjective) {
+            return false;
+        }
+    }
+    return !infos.empty();
+}
+
+Leaderboard* findLeaderboard(Scoreboard& scoreboard, std::string const& objective) {
+    auto obj = scoreboard.getObjective(objective);
+    if (!obj) {
+        return nullptr;
+    }
+    auto it = mLeaderboards.find(obj);
+    return it != mLeaderboards.end() ? &it->second : nullptr;
+}
+
+void setLeaderboardScore(Leaderboard& board, ScoreboardId const& id, int score) {
+    if (board.set(id.mRawID, score)) {
+        auto& entry = mLeaderboardIds[id.mRawID];
+        entry.mId   = id;
+        entry.mBoards++;
+    }
+}
+
+void releaseLeaderboardId(int64_t id) {
+    auto it = mLeaderboardIds.find(id);
+    if (it != mLeaderboardIds.end() && --it->second.mBoards == 0) {
+        mLeaderboardIds.erase(it);
+    }
+}
+
+void removeLeaderboardScore(Leaderboard& board, int64_t id) {
+    if (board.remove(id)) {
+        releaseLeaderboardId(id);
+    }
+}
+
+// Must be called before a leaderboard is dropped or replaced.
+void releaseLeaderboard(Leaderboard const& board) {
+    for (auto& entry : board.getRange(0, board.size())) {
+        releaseLeaderboardId(entry.mId);
+    }
+}
+
+std::vector<LeaderboardEntry> toLeaderboardEntries(std::vector<Leaderboard::Entry> const& entries) {
+    std::vector<LeaderboardEntry> result;
+    result.reserve(entries.size());
+    for (auto& entry : entries) {
+        auto it = mLeaderboardIds.find(entry.mId);
+        if (it != mLeaderboardIds.end()) {
+            result.push_back({it->second.mId, entry.mScore});
+        }
+    }
+    return result;
+}
+
+std::string encodeScoreChanges(
+    Scoreboard&                      scoreboard,
+    Objective&                       objective,
+    std::vector<ScoreboardId> const& ids,
+    std::vector<int> const&          scores
+) {
+    GMLIB_BinaryStream bs;
+    bs.writeUnsignedChar((uchar)ScorePacketType::Change);
+    bs.writeUnsignedVarInt((uint)ids.size());
+    for (size_t i = 0; i < ids.size(); i++) {
+        auto& identity = scoreboard.getIdentityDefinition(ids[i]);
+        auto  type     = identity.getIdentityType();
+        bs.writeVarInt64(ids[i].mRawID);
+        bs.writeString(objective.getName());
+        bs.writeSignedInt(scores[i]);
+        bs.writeUnsignedChar((uchar)type);
+        switch (type) {
+        case IdentityDefinition::Type::Player:
+            bs.writeVarInt64(identity.getPlayerId().mActorUniqueId.id);
+            break;
+        case IdentityDefinition::Type::Entity:
+            bs.writeVarInt64(identity.getEntityId().id);
+            break;
+        case IdentityDefinition::Type::FakePlayer:
+            bs.writeString(identity.getFakePlayerName());
+            break;
+        default:
+            break;
+        }
+    }
+    return bs.getAndReleaseData();
+}
+
+} // namespace GMLIB::ScoreboardAPI
+
 GMLIB_Scoreboard* GMLIB_Scoreboard::getServerScoreboard() {
     return (GMLIB_Scoreboard*)&ll::service::bedrock::getLevel()->getScoreboard();
 }
@@ -21,22 +160,29 @@ bool GMLIB_Scoreboard::removeObjective(std::string objective) {
 }
 
 std::optional<int> GMLIB_Scoreboard::getScore(Objective* objective, ScoreboardId& scoreboardId) {
-    if (objective && scoreboardId.isValid()) {
-        auto scores = getIdScores(scoreboardId);
-        for (auto& score : scores) {
-            if (score.mObjective == objective) {
-                return score.mScore;
-            }
+    if (!objective || !scoreboardId.isValid()) {
+        return {};
+    }
+    auto& cache = GMLIB::ScoreboardAPI::mScoreCache;
+    if (auto cached = cache.find(objective, scoreboardId.mRawID)) {
+        return *cached;
+    }
+    std::optional<int> result;
+    auto               scores = getIdScores(scoreboardId);
+    for (auto& score : scores) {
+        if (score.mObjective == objective) {
+            result = score.mScore;
+            break;
         }
     }
-    return {};
+    cache.insert(objective, scoreboardId.mRawID, result);
+    return result;
 }
 
 ScoreboardId GMLIB_Scoreboard::getPlayerScoreboardId(std::string serverid) {
-    auto nbt = GMLIB_Player::getOfflineNbt(serverid);
-    if (nbt && nbt->contains("UniqueID")) {
-        auto auid = nbt->getInt64("UniqueID");
-        auto psid = PlayerScoreboardId(auid);
+    auto auid = GMLIB::PlayerAPI::getUniqueId(serverid);
+    if (auid) {
+        auto psid = PlayerScoreboardId(*auid);
         return getScoreboardId(psid);
     }
     return ScoreboardId::INVALID;
@@ -90,6 +236,56 @@ GMLIB_Scoreboard::setScore(Objective* objective, ScoreboardId& scoreboardId, int
     return {};
 }
 
+std::vector<std::optional<int>>
+GMLIB_Scoreboard::setScores(std::string objective, std::vector<ScoreChange> const& changes) {
+    std::vector<std::optional<int>> results(changes.size());
+    auto                            obj = getObjective(objective);
+    if (!obj) {
+        obj = addObjective(objective);
+    }
+    if (!obj || changes.empty()) {
+        return results;
+    }
+    std::vector<ScoreboardId>   changed;
+    std::unordered_set<int64_t> changedIds;
+    changed.reserve(changes.size());
+    // The score packets the server would send for each change are dropped, viewers get one packet after all of them.
+    size_t suppressedPackets = 0;
+    {
+        GMLIB::ScoreboardAPI::ScoreSyncSuppression suppression(obj->getName());
+        for (size_t i = 0; i < changes.size(); i++) {
+            auto& change = changes[i];
+            if (!change.mId.isValid()) {
+                continue;
+            }
+            bool success = true;
+            results[i]   = modifyPlayerScore(success, change.mId, *obj, change.mValue, change.mAction);
+            if (changedIds.insert(change.mId.mRawID).second) {
+                changed.push_back(change.mId);
+            }
+        }
+        suppressedPackets = suppression.mPackets;
+    }
+    if (suppressedPackets == 0) {
+        // The objective is not displayed.
+        return results;
+    }
+    std::vector<ScoreboardId> ids;
+    std::vector<int>          scores;
+    for (auto& id : changed) {
+        if (auto score = getScore(obj, id)) {
+            ids.push_back(id);
+            scores.push_back(*score);
+        }
+    }
+    if (!ids.empty()) {
+        auto data = GMLIB::ScoreboardAPI::encodeScoreChanges(*this, *obj, ids, scores);
+        GMLIB_NetworkPacket<(int)MinecraftPacketIds::SetScore> pkt(data);
+        pkt.sendToClients();
+    }
+    return results;
+}
+
 std::optional<int>
 GMLIB_Scoreboard::setScore(std::string objective, std::string name, int value, PlayerScoreSetFunction action) {
     auto id  = getScoreboardId(name);
@@ -240,4 +436,159 @@ bool GMLIB_Scoreboard::setObjectiveDisplayName(std::string objective, std::strin
         return true;
     }
     return false;
-}
\ No newline at end of file
+}
+ScoreCacheStatistics GMLIB_Scoreboard::getScoreCacheStatistics() {
+    auto& cache      = GMLIB::ScoreboardAPI::mScoreCache;
+    auto& statistics = cache.getStatistics();
+    return {statistics.mHits, statistics.mMisses, statistics.mInvalidations, cache.size()};
+}
+
+void GMLIB_Scoreboard::resetScoreCacheStatistics() { GMLIB::ScoreboardAPI::mScoreCache.resetStatistics(); }
+
+bool GMLIB_Scoreboard::registerLeaderboard(std::string objective, ObjectiveSortOrder sortOrder) {
+    auto obj = getObjective(objective);
+    if (!obj) {
+        return false;
+    }
+    auto& board = GMLIB::ScoreboardAPI::mLeaderboards[obj];
+    GMLIB::ScoreboardAPI::releaseLeaderboard(board);
+    board = GMLIB::ScoreboardAPI::Leaderboard(sortOrder == ObjectiveSortOrder::Descending);
+    for (auto& id : getTrackedIds()) {
+        if (auto score = getScore(obj, id)) {
+            GMLIB::ScoreboardAPI::setLeaderboardScore(board, id, *score);
+        }
+    }
+    return true;
+}
+
+bool GMLIB_Scoreboard::unregisterLeaderboard(std::string objective) {
+    auto obj = getObjective(objective);
+    if (!obj) {
+        return false;
+    }
+    auto it = GMLIB::ScoreboardAPI::mLeaderboards.find(obj);
+    if (it == GMLIB::ScoreboardAPI::mLeaderboards.end()) {
+        return false;
+    }
+    GMLIB::ScoreboardAPI::releaseLeaderboard(it->second);
+    GMLIB::ScoreboardAPI::mLeaderboards.erase(it);
+    return true;
+}
+
+bool GMLIB_Scoreboard::hasLeaderboard(std::string objective) {
+    return GMLIB::ScoreboardAPI::findLeaderboard(*this, objective);
+}
+
+size_t GMLIB_Scoreboard::getLeaderboardSize(std::string objective) {
+    auto board = GMLIB::ScoreboardAPI::findLeaderboard(*this, objective);
+    return board ? board->size() : 0;
+}
+
+std::vector<LeaderboardEntry> GMLIB_Scoreboard::getLeaderboardTop(std::string objective, size_t count) {
+    return getLeaderboardRange(objective, 0, count);
+}
+
+std::vector<LeaderboardEntry>
+GMLIB_Scoreboard::getLeaderboardRange(std::string objective, size_t offset, size_t count) {
+    if (auto board = GMLIB::ScoreboardAPI::findLeaderboard(*this, objective)) {
+        return GMLIB::ScoreboardAPI::toLeaderboardEntries(board->getRange(offset, count));
+    }
+    return {};
+}
+
+std::vector<LeaderboardEntry>
+GMLIB_Scoreboard::getLeaderboardScoreRange(std::string objective, int minScore, int maxScore, size_t limit) {
+    if (auto board = GMLIB::ScoreboardAPI::findLeaderboard(*this, objective)) {
+        return GMLIB::ScoreboardAPI::toLeaderboardEntries(board->getScoreRange(minScore, maxScore, limit));
+    }
+    return {};
+}
+
+std::optional<size_t> GMLIB_Scoreboard::getLeaderboardRank(std::string objective, ScoreboardId& scoreboardId) {
+    auto board = GMLIB::ScoreboardAPI::findLeaderboard(*this, objective);
+    if (board && scoreboardId.isValid()) {
+        return board->getRank(scoreboardId.mRawID);
+    }
+    return {};
+}
+
+LL_AUTO_TYPE_INSTANCE_HOOK(
+    ScoreChangedHook,
+    ll::memory::HookPriority::Normal,
+    ServerScoreboard,
+    "?onScoreChanged@ServerScoreboard@@UEAAXAEBUScoreboardId@@AEBVObjective@@@Z",
+    void,
+    ScoreboardId const& scoreboardId,
+    Objective const&    objective
+) {
+    GMLIB_PROFILE_HOOK(ScoreChangedHook);
+    GMLIB::ScoreboardAPI::mScoreCache.invalidate(&objective, scoreboardId.mRawID);
+    GMLIB_PROFILE_ORIGIN(origin(scoreboardId, objective));
+    auto board = GMLIB::ScoreboardAPI::mLeaderboards.find(&objective);
+    if (board != GMLIB::ScoreboardAPI::mLeaderboards.end()) {
+        // Read from the objective, the cache entry was just invalidated.
+        auto score = objective.getPlayerScore(scoreboardId);
+        if (score.mValid) {
+            GMLIB::ScoreboardAPI::setLeaderboardScore(board->second, scoreboardId, score.mValue);
+        } else {
+            GMLIB::ScoreboardAPI::removeLeaderboardScore(board->second, scoreboardId.mRawID);
+        }
+    }
+}
+
+LL_AUTO_TYPE_INSTANCE_HOOK(
+    PlayerScoreRemovedHook,
+    ll::memory::HookPriority::Normal,
+    ServerScoreboard,
+    "?onPlayerScoreRemoved@ServerScoreboard@@UEAAXAEBUScoreboardId@@AEBVObjective@@@Z",
+    void,
+    ScoreboardId const& scoreboardId,
+    Objective const&    objective
+) {
+    GMLIB_PROFILE_HOOK(PlayerScoreRemovedHook);
+    GMLIB::ScoreboardAPI::mScoreCache.invalidate(&objective, scoreboardId.mRawID);
+    auto board = GMLIB::ScoreboardAPI::mLeaderboards.find(&objective);
+    if (board != GMLIB::ScoreboardAPI::mLeaderboards.end()) {
+        GMLIB::ScoreboardAPI::removeLeaderboardScore(board->second, scoreboardId.mRawID);
+    }
+    return GMLIB_PROFILE_ORIGIN(origin(scoreboardId, objective));
+}
+
+LL_AUTO_TYPE_INSTANCE_HOOK(
+    ObjectiveRemovedHook,
+    ll::memory::HookPriority::Normal,
+    ServerScoreboard,
+    "?onObjectiveRemoved@ServerScoreboard@@UEAAXAEAVObjective@@@Z",
+    void,
+    Objective& objective
+) {
+    GMLIB_PROFILE_HOOK(ObjectiveRemovedHook);
+    // A new objective can reuse the address, its scores must not be served from the cache.
+    GMLIB::ScoreboardAPI::mScoreCache.clear();
+    auto board = GMLIB::ScoreboardAPI::mLeaderboards.find(&objective);
+    if (board != GMLIB::ScoreboardAPI::mLeaderboards.end()) {
+        GMLIB::ScoreboardAPI::releaseLeaderboard(board->second);
+        GMLIB::ScoreboardAPI::mLeaderboards.erase(board);
+    }
+    return GMLIB_PROFILE_ORIGIN(origin(objective));
+}
+
+LL_AUTO_TYPE_INSTANCE_HOOK(
+    ScorePacketBroadcastHook,
+    ll::memory::HookPriority::Normal,
+    LoopbackPacketSender,
+    "?sendBroadcast@LoopbackPacketSender@@UEAAXAEBVPacket@@@Z",
+    void,
+    Packet const& packet
+) {
+    GMLIB_PROFILE_HOOK(ScorePacketBroadcastHook);
+    auto suppression = GMLIB::ScoreboardAPI::mScoreSyncSuppression;
+    while (suppression) {
+        if (suppression->suppresses(packet)) {
+            suppression->mPackets++;
+            return;
+        }
+        suppression = suppression->mPrevious;
+    }
+    return GMLIB_PROFILE_ORIGIN(origin(packet));
+}
@@ -0,0 +1,218 @@
+#include "Server/ScoreboardAPI/Leaderboard.h"
+
+namespace GMLIB::ScoreboardAPI {
+
+Leaderboard::Leaderboard(bool descending) : mNodes(1), mDescending(descending) { mNodes[0].mSize = 0; }
+
+int64_t Leaderboard::toKey(int score) const { return mDescending ? -(int64_t)score : (int64_t)score; }
+
+bool Leaderboard::less(Node const& node, int64_t key, int64_t id) {
+    return node.mKey < key || (node.mKey == key && node.mId < id);
+}
+
+uint32_t Leaderboard::allocateNode(int64_t id, int score) {
+    // xorshift64, the priorities only have to be independent of the scores.
+    mSeed ^= mSeed << 13;
+    mSeed ^= mSeed >> 7;
+    mSeed ^= mSeed << 17;
+    Node node{toKey(score), id, score, (uint32_t)(mSeed >> 32)};
+    if (!mFreeNodes.empty()) {
+        auto index = mFreeNodes.back();
+        mFreeNodes.pop_back();
+        mNodes[index] = node;
+        return index;
+    }
+    mNodes.push_back(node);
+    return (uint32_t)mNodes.size() - 1;
+}
+
+void Leaderboard::update(uint32_t node) {
+    auto& current = mNodes[node];
+    current.mSize = mNodes[current.mLeft].mSize + mNodes[current.mRight].mSize + 1;
+}
+
+void Leaderboard::split(uint32_t tree, int64_t key, int64_t id, uint32_t& left, uint32_t& right) {
+    if (!tree) {
+        left = right = 0;
+        return;
+    }
+    if (less(mNodes[tree], key, id)) {
+        split(mNodes[tree].mRight, key, id, mNodes[tree].mRight, right);
+        left = tree;
+    } else {
+        split(mNodes[tree].mLeft, key, id, left, mNodes[tree].mLeft);
+        right = tree;
+    }
+    update(tree);
+}
+
+uint32_t Leaderboard::merge(uint32_t left, uint32_t right) {
+    if (!left || !right) {
+        return left ? left : right;
+    }
+    if (mNodes[left].mPriority > mNodes[right].mPriority) {
+        mNodes[left].mRight = merge(mNodes[left].mRight, right);
+        update(left);
+        return left;
+    }
+    mNodes[right].mLeft = merge(left, mNodes[right].mLeft);
+    update(right);
+    return right;
+}
+
+uint32_t Leaderboard::erase(uint32_t tree, int64_t key, int64_t id) {
+    auto& node = mNodes[tree];
+    if (node.mKey == key && node.mId == id) {
+        mFreeNodes.push_back(tree);
+        return merge(node.mLeft, node.mRight);
+    }
+    if (less(node, key, id)) {
+        mNodes[tree].mRight = erase(node.mRight, key, id);
+    } else {
+        mNodes[tree].mLeft = erase(node.mLeft, key, id);
+    }
+    update(tree);
+    return tree;
+}
+
+bool Leaderboard::set(int64_t id, int score) {
+    auto it    = mIndex.find(id);
+    bool added = it == mIndex.end();
+    if (!added) {
+        if (mNodes[it->second].mScore == score) {
+            return false;
+        }
+        auto& old = mNodes[it->second];
+        mRoot     = erase(mRoot, old.mKey, id);
+    }
+    auto node = allocateNode(id, score);
+    mIndex.insert_or_assign(id, node);
+    uint32_t left;
+    uint32_t right;
+    split(mRoot, mNodes[node].mKey, id, left, right);
+    mRoot = merge(merge(left, node), right);
+    return added;
+}
+
+bool Leaderboard::remove(int64_t id) {
+    auto it = mIndex.find(id);
+    if (it == mIndex.end()) {
+        return false;
+    }
+    mRoot = erase(mRoot, mNodes[it->second].mKey, id);
+    mIndex.erase(it);
+    return true;
+}
+
+void Leaderboard::clear() {
+    mNodes.resize(1);
+    mFreeNodes.clear();
+    mIndex.clear();
+    mRoot = 0;
+}
+
+size_t Leaderboard::size() const { return mIndex.size(); }
+
+std::optional<int> Leaderboard::getScore(int64_t id) const {
+    auto it = mIndex.find(id);
+    if (it == mIndex.end()) {
+        return {};
+    }
+    return mNodes[it->second].mScore;
+}
+
+std::optional<size_t> Leaderboard::getRank(int64_t id) const {
+    auto it = mIndex.find(id);
+    if (it == mIndex.end()) {
+        return {};
+    }
+    auto   key  = mNodes[it->second].mKey;
+    size_t rank = 0;
+    for (auto tree = mRoot; tree;) {
+        auto& node = mNodes[tree];
+        if (node.mKey == key && node.mId == id) {
+            return rank + mNodes[node.mLeft].mSize;
+        }
+        if (less(node, key, id)) {
+            rank += mNodes[node.mLeft].mSize + 1;
+            tree  = node.mRight;
+        } else {
+            tree = node.mLeft;
+        }
+    }
+    return {};
+}
+
+std::vector<Leaderboard::Entry> Leaderboard::getTop(size_t count) const { return getRange(0, count); }
+
+std::vector<Leaderboard::Entry> Leaderboard::getRange(size_t offset, size_t count) const {
+    std::vector<Entry> result;
+    if (offset < size()) {
+        result.reserve(std::min(count, size() - offset));
+        collectRange(mRoot, offset, count, result);
+    }
+    return result;
+}
+
+std::vector<Leaderboard::Entry> Leaderboard::getScoreRange(int minScore, int maxScore, size_t limit) const {
+    std::vector<Entry> result;
+    if (minScore <= maxScore) {
+        auto minKey = mDescending ? toKey(maxScore) : toKey(minScore);
+        auto maxKey = mDescending ? toKey(minScore) : toKey(maxScore);
+        collectKeys(mRoot, minKey, maxKey, limit, result);
+    }
+    return result;
+}
+
+void Leaderboard::collectRange(uint32_t tree, size_t offset, size_t count, std::vector<Entry>& result) const {
+    // count is what is still wanted from this subtree, entries already collected come from before it.
+    while (tree && count) {
+        auto& node     = mNodes[tree];
+        auto  leftSize = mNodes[node.mLeft].mSize;
+        if (offset < leftSize) {
+            auto before = result.size();
+            collectRange(node.mLeft, offset, count, result);
+            count  -= result.size() - before;
+            offset  = 0;
+        } else {
+            offset -= leftSize;
+        }
+        if (!count) {
+            return;
+        }
+        if (offset == 0) {
+            result.push_back({node.mId, node.mScore});
+            count--;
+        } else {
+            offset--;
+        }
+        tree = node.mRight;
+    }
+}
+
+void Leaderboard::collectKeys(
+    uint32_t            tree,
+    int64_t             minKey,
+    int64_t             maxKey,
+    size_t              limit,
+    std::vector<Entry>& result
+) const {
+    while (tree && result.size() < limit) {
+        auto& node = mNodes[tree];
+        if (node.mKey < minKey) {
+            tree = node.mRight;
+            continue;
+        }
+        if (node.mKey > maxKey) {
+            tree = node.mLeft;
+            continue;
+        }
+        collectKeys(node.mLeft, minKey, maxKey, limit, result);
+        if (result.size() < limit) {
+            result.push_back({node.mId, node.mScore});
+        }
+        tree = node.mRight;
+    }
+}
+
+} // namespace GMLIB::ScoreboardAPI
@@ -0,0 +1,83 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+// Engine independent. Scores of one objective kept in order, a treap with subtree sizes, so that ranks, top lists
+// and ranges take O(log N) plus the entries returned. Equal scores are ordered by id.
+namespace GMLIB::ScoreboardAPI {
+
+class Leaderboard {
+public:
+    struct Entry {
+        int64_t mId;
+        int     mScore;
+    };
+
+private:
+    struct Node {
+        int64_t  mKey; // The score, negated for a descending board
+        int64_t  mId;
+        int      mScore;
+        uint32_t mPriority;
+        uint32_t mLeft  = 0;
+        uint32_t mRight = 0;
+        uint32_t mSize  = 1;
+    };
+
+    std::vector<Node>                     mNodes; // Index 0 is the empty tree
+    std::vector<uint32_t>                 mFreeNodes;
+    std::unordered_map<int64_t, uint32_t> mIndex; // Node of each id
+    uint32_t                              mRoot = 0;
+    bool                                  mDescending;
+    uint64_t                              mSeed = 0x9E3779B97F4A7C15ull;
+
+public:
+    explicit Leaderboard(bool descending = true);
+
+public:
+    // Returns true when the id was not on the leaderboard yet.
+    bool set(int64_t id, int score);
+
+    bool remove(int64_t id);
+
+    void clear();
+
+    size_t size() const;
+
+    std::optional<int> getScore(int64_t id) const;
+
+    // 0 is the first place.
+    std::optional<size_t> getRank(int64_t id) const;
+
+    std::vector<Entry> getTop(size_t count) const;
+
+    std::vector<Entry> getRange(size_t offset, size_t count) const;
+
+    // Entries with minScore <= score <= maxScore in board order, at most limit of them.
+    std::vector<Entry> getScoreRange(int minScore, int maxScore, size_t limit = SIZE_MAX) const;
+
+private:
+    int64_t toKey(int score) const;
+
+    static bool less(Node const& node, int64_t key, int64_t id);
+
+    uint32_t allocateNode(int64_t id, int score);
+
+    void update(uint32_t node);
+
+    // Splits tree into the nodes before (key, id) and the rest.
+    void split(uint32_t tree, int64_t key, int64_t id, uint32_t& left, uint32_t& right);
+
+    uint32_t merge(uint32_t left, uint32_t right);
+
+    uint32_t erase(uint32_t tree, int64_t key, int64_t id);
+
+    void collectRange(uint32_t tree, size_t offset, size_t count, std::vector<Entry>& result) const;
+
+    void collectKeys(uint32_t tree, int64_t minKey, int64_t maxKey, size_t limit, std::vector<Entry>& result) const;
+};
+
+} // namespace GMLIB::ScoreboardAPI
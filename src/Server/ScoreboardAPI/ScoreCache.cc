@@ -0,0 +1,84 @@
+#include "Server/ScoreboardAPI/ScoreCache.h"
+
+namespace GMLIB::ScoreboardAPI {
+
+ScoreCache::ScoreCache(size_t maxEntries) : mMaxEntries(maxEntries) {}
+
+std::optional<int> const* ScoreCache::find(void const* objective, int64_t id) {
+    auto it = mIndex.find({objective, id});
+    if (it == mIndex.end()) {
+        mStatistics.mMisses++;
+        return nullptr;
+    }
+    mStatistics.mHits++;
+    auto& entry       = mEntries[it->second];
+    entry.mReferenced = true;
+    return &entry.mScore;
+}
+
+void ScoreCache::insert(void const* objective, int64_t id, std::optional<int> score) {
+    Key  key{objective, id};
+    auto it = mIndex.find(key);
+    if (it != mIndex.end()) {
+        mEntries[it->second].mScore = score;
+        return;
+    }
+    if (mMaxEntries == 0) {
+        return;
+    }
+    if (mEntries.size() < mMaxEntries) {
+        mIndex.emplace(key, mEntries.size());
+        mEntries.push_back({key, score});
+        return;
+    }
+    // Reads of many distinct ids would otherwise grow it without bound.
+    auto position = findVictim();
+    mIndex.erase(mEntries[position].mKey);
+    mIndex.emplace(key, position);
+    mEntries[position] = {key, score};
+    mStatistics.mEvictions++;
+}
+
+size_t ScoreCache::findVictim() {
+    while (true) {
+        if (mHand >= mEntries.size()) {
+            mHand = 0;
+        }
+        auto& entry = mEntries[mHand++];
+        if (!entry.mReferenced) {
+            return mHand - 1;
+        }
+        entry.mReferenced = false;
+    }
+}
+
+void ScoreCache::invalidate(void const* objective, int64_t id) {
+    auto it = mIndex.find({objective, id});
+    if (it == mIndex.end()) {
+        return;
+    }
+    auto position = it->second;
+    mIndex.erase(it);
+    // The last entry fills the gap, so that entries stay contiguous for the clock hand.
+    if (position + 1 != mEntries.size()) {
+        mEntries[position]                           = std::move(mEntries.back());
+        mIndex.find(mEntries[position].mKey)->second = position;
+    }
+    mEntries.pop_back();
+    mStatistics.mInvalidations++;
+}
+
+void ScoreCache::clear() {
+    mStatistics.mInvalidations += mEntries.size();
+    mIndex.clear();
+    mEntries.clear();
+    mHand = 0;
+}
+
+size_t ScoreCache::size() const { return mEntries.size(); }
+
+ScoreCache::Statistics const& ScoreCache::getStatistics() const { return mStatistics; }
+
+void ScoreCache::resetStatistics() { mStatistics = {}; }
+
+} // namespace GMLIB::ScoreboardAPI
@@ -0,0 +1,72 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+// Engine independent. Scores by (objective, scoreboard id), so that repeated reads are a single hash lookup.
+// The owner invalidates entries whenever the scoreboard changes a score.
+// A full cache evicts one entry per insert, the first one the clock hand finds unread since it last passed
+// (second chance), so that scores read every tick stay cached while one-off reads cycle through.
+namespace GMLIB::ScoreboardAPI {
+
+class ScoreCache {
+public:
+    struct Key {
+        void const* mObjective;
+        int64_t     mId;
+
+        bool operator==(Key const&) const = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(Key const& key) const {
+            return std::hash<void const*>()(key.mObjective) ^ (std::hash<int64_t>()(key.mId) * 0x9E3779B97F4A7C15ull);
+        }
+    };
+
+    struct Statistics {
+        uint64_t mHits          = 0;
+        uint64_t mMisses        = 0;
+        uint64_t mInvalidations = 0;
+        uint64_t mEvictions     = 0;
+    };
+
+private:
+    struct Entry {
+        Key                mKey;
+        std::optional<int> mScore; // Empty caches a missing score
+        bool               mReferenced = false;
+    };
+
+    std::unordered_map<Key, size_t, KeyHash> mIndex; // Position in mEntries
+    std::vector<Entry>                       mEntries;
+    size_t                                   mHand = 0;
+    size_t                                   mMaxEntries;
+    Statistics                               mStatistics;
+
+public:
+    explicit ScoreCache(size_t maxEntries = 1 << 20);
+
+    // Does not allocate. nullptr on a miss, the caller then reads the score and inserts it.
+    // The result is valid until the cache is modified.
+    std::optional<int> const* find(void const* objective, int64_t id);
+
+    void insert(void const* objective, int64_t id, std::optional<int> score);
+
+    void invalidate(void const* objective, int64_t id);
+
+    void clear();
+
+    size_t size() const;
+
+    Statistics const& getStatistics() const;
+
+    void resetStatistics();
+
+private:
+    // Moves the clock hand to an entry to evict and returns its position.
+    size_t findVictim();
+};
+
+} // namespace GMLIB::ScoreboardAPI
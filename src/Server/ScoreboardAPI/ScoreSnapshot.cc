@@ -0,0 +1,291 @@
+#include "Server/ScoreboardAPI/ScoreSnapshot.h"
+#include <algorithm>
+#include <optional>
+
+namespace GMLIB::ScoreboardAPI {
+
+enum class BlockKind : uint8_t {
+    End        = 0,
+    Objective  = 1,
+    Identities = 2,
+    Scores     = 3
+};
+
+void writeVarUInt(std::string& buffer, uint64_t value) {
+    while (value >= 0x80) {
+        buffer.push_back((char)(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back((char)value);
+}
+
+void writeVarInt(std::string& buffer, int64_t value) {
+    writeVarUInt(buffer, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+}
+
+void writeString(std::string& buffer, std::string_view value) {
+    writeVarUInt(buffer, value.size());
+    buffer.append(value);
+}
+
+ScoreSnapshotWriter::ScoreSnapshotWriter(std::ostream& stream) : mStream(stream) {
+    uint32_t header[] = {MAGIC, VERSION};
+    mStream.write((char const*)header, sizeof(header));
+}
+
+uint32_t ScoreSnapshotWriter::addObjective(SnapshotObjective const& objective) {
+    auto index = (uint32_t)mScores.size();
+    mScores.emplace_back();
+    mBuffer.push_back((char)BlockKind::Objective);
+    writeVarUInt(mBuffer, index);
+    writeString(mBuffer, objective.mName);
+    writeString(mBuffer, objective.mDisplayName);
+    writeString(mBuffer, objective.mCriteria);
+    flushBuffer();
+    return index;
+}
+
+void ScoreSnapshotWriter::writeIdentity(SnapshotIdentity identity) {
+    mIdentities.push_back(std::move(identity));
+    mIdentityCount++;
+    if (mIdentities.size() >= BLOCK_SIZE) {
+        flushIdentities();
+    }
+}
+
+void ScoreSnapshotWriter::writeScore(uint32_t objective, int64_t id, int score) {
+    auto& scores = mScores.at(objective);
+    scores.push_back({id, score});
+    mScoreCount++;
+    if (scores.size() >= BLOCK_SIZE) {
+        flushScores(objective);
+    }
+}
+
+bool ScoreSnapshotWriter::finish() {
+    flushIdentities();
+    for (uint32_t objective = 0; objective < mScores.size(); objective++) {
+        flushScores(objective);
+    }
+    mBuffer.push_back((char)BlockKind::End);
+    writeVarUInt(mBuffer, mIdentityCount);
+    writeVarUInt(mBuffer, mScoreCount);
+    flushBuffer();
+    mStream.flush();
+    return mStream.good();
+}
+
+void ScoreSnapshotWriter::flushIdentities() {
+    if (mIdentities.empty()) {
+        return;
+    }
+    mBuffer.push_back((char)BlockKind::Identities);
+    writeVarUInt(mBuffer, mIdentities.size());
+    int64_t last = 0;
+    for (auto& identity : mIdentities) {
+        writeVarInt(mBuffer, (int64_t)((uint64_t)identity.mId - (uint64_t)last));
+        last = identity.mId;
+        mBuffer.push_back((char)identity.mType);
+        if (identity.mType == SnapshotIdentity::Type::FakePlayer) {
+            writeString(mBuffer, identity.mName);
+        } else {
+            writeVarInt(mBuffer, identity.mUniqueId);
+        }
+    }
+    mIdentities.clear();
+    flushBuffer();
+}
+
+void ScoreSnapshotWriter::flushScores(uint32_t objective) {
+    auto& scores = mScores[objective];
+    if (scores.empty()) {
+        return;
+    }
+    // A reader only knows the ids of the identity blocks before this one.
+    flushIdentities();
+    mBuffer.push_back((char)BlockKind::Scores);
+    writeVarUInt(mBuffer, objective);
+    writeVarUInt(mBuffer, scores.size());
+    int64_t last = 0;
+    for (auto& score : scores) {
+        writeVarInt(mBuffer, (int64_t)((uint64_t)score.mId - (uint64_t)last));
+        last = score.mId;
+        writeVarInt(mBuffer, score.mScore);
+    }
+    scores.clear();
+    flushBuffer();
+}
+
+void ScoreSnapshotWriter::flushBuffer() {
+    mStream.write(mBuffer.data(), (std::streamsize)mBuffer.size());
+    mBuffer.clear();
+}
+
+// Reads the stream in chunks, istream::get per byte would dominate the import.
+class SnapshotInput {
+    std::istream&     mStream;
+    std::vector<char> mBuffer;
+    size_t            mPosition = 0;
+    size_t            mSize     = 0;
+
+public:
+    explicit SnapshotInput(std::istream& stream) : mStream(stream), mBuffer(1 << 16) {}
+
+    std::optional<uint8_t> readByte() {
+        if (mPosition == mSize && !fill()) {
+            return {};
+        }
+        return (uint8_t)mBuffer[mPosition++];
+    }
+
+    std::optional<uint64_t> readVarUInt() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            auto byte = readByte();
+            if (!byte) {
+                return {};
+            }
+            value |= (uint64_t)(*byte & 0x7f) << shift;
+            if (!(*byte & 0x80)) {
+                return value;
+            }
+        }
+        return {};
+    }
+
+    std::optional<int64_t> readVarInt() {
+        auto value = readVarUInt();
+        if (!value) {
+            return {};
+        }
+        return (int64_t)((*value >> 1) ^ (~(*value & 1) + 1));
+    }
+
+    bool readString(std::string& value) {
+        auto size = readVarUInt();
+        if (!size || *size > (1u << 20)) {
+            return false;
+        }
+        value.clear();
+        while (value.size() < *size) {
+            if (mPosition == mSize && !fill()) {
+                return false;
+            }
+            auto count = std::min<size_t>(*size - value.size(), mSize - mPosition);
+            value.append(mBuffer.data() + mPosition, count);
+            mPosition += count;
+        }
+        return true;
+    }
+
+private:
+    bool fill() {
+        mStream.read(mBuffer.data(), (std::streamsize)mBuffer.size());
+        mSize     = (size_t)mStream.gcount();
+        mPosition = 0;
+        return mSize > 0;
+    }
+};
+
+ScoreSnapshotReader::ScoreSnapshotReader(std::istream& stream) : mStream(stream) {}
+
+bool ScoreSnapshotReader::read(Handler& handler) {
+    uint32_t header[2];
+    if (!mStream.read((char*)header, sizeof(header)) || header[0] != ScoreSnapshotWriter::MAGIC
+        || header[1] != ScoreSnapshotWriter::VERSION) {
+        return false;
+    }
+    SnapshotInput                 input(mStream);
+    uint32_t                      objectiveCount = 0;
+    uint64_t                      identityCount  = 0;
+    uint64_t                      scoreCount     = 0;
+    std::vector<SnapshotIdentity> identities;
+    std::vector<SnapshotScore>    scores;
+    while (true) {
+        auto kind = input.readByte();
+        if (!kind) {
+            return false;
+        }
+        switch ((BlockKind)*kind) {
+        case BlockKind::Objective: {
+            SnapshotObjective objective;
+            auto              index = input.readVarUInt();
+            // Objectives are numbered in the order they are written.
+            if (!index || *index != objectiveCount || !input.readString(objective.mName)
+                || !input.readString(objective.mDisplayName) || !input.readString(objective.mCriteria)
+                || !handler.onObjective(objectiveCount, objective)) {
+                return false;
+            }
+            objectiveCount++;
+            break;
+        }
+        case BlockKind::Identities: {
+            auto count = input.readVarUInt();
+            if (!count || *count > ScoreSnapshotWriter::BLOCK_SIZE) {
+                return false;
+            }
+            identities.resize(*count);
+            int64_t last = 0;
+            for (auto& identity : identities) {
+                auto delta = input.readVarInt();
+                auto type  = input.readByte();
+                if (!delta || !type) {
+                    return false;
+                }
+                identity.mId   = last = (int64_t)((uint64_t)last + (uint64_t)*delta);
+                identity.mType = (SnapshotIdentity::Type)*type;
+                identity.mName.clear();
+                identity.mUniqueId = 0;
+                if (identity.mType == SnapshotIdentity::Type::FakePlayer) {
+                    if (!input.readString(identity.mName)) {
+                        return false;
+                    }
+                } else {
+                    auto uniqueId = input.readVarInt();
+                    if (!uniqueId) {
+                        return false;
+                    }
+                    identity.mUniqueId = *uniqueId;
+                }
+            }
+            identityCount += identities.size();
+            if (!handler.onIdentities(identities)) {
+                return false;
+            }
+            break;
+        }
+        case BlockKind::Scores: {
+            auto objective = input.readVarUInt();
+            auto count     = input.readVarUInt();
+            if (!objective || *objective >= objectiveCount || !count || *count > ScoreSnapshotWriter::BLOCK_SIZE) {
+                return false;
+            }
+            scores.resize(*count);
+            int64_t last = 0;
+            for (auto& score : scores) {
+                auto delta = input.readVarInt();
+                auto value = input.readVarInt();
+                if (!delta || !value) {
+                    return false;
+                }
+                score.mId    = last = (int64_t)((uint64_t)last + (uint64_t)*delta);
+                score.mScore = (int)*value;
+            }
+            scoreCount += scores.size();
+            if (!handler.onScores((uint32_t)*objective, scores)) {
+                return false;
+            }
+            break;
+        }
+        case BlockKind::End: {
+            auto identities = input.readVarUInt();
+            auto scores     = input.readVarUInt();
+            return identities && scores && *identities == identityCount && *scores == scoreCount;
+        }
+        default:
+            return false;
+        }
+    }
+}
+
+} // namespace GMLIB::ScoreboardAPI
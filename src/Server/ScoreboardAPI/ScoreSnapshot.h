@@ -0,0 +1,111 @@
+#pragma once
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Engine independent. Streaming scoreboard snapshot, written and read in blocks of at most BLOCK_SIZE records, so
+// that memory does not grow with the number of scores.
+//
+// Layout (varints are LEB128, signed values zigzag encoded):
+//   uint32 magic, uint32 version
+//   blocks, each starting with a uint8 kind:
+//     Objective   varint index, string name, string display name, string criteria
+//     Identities  varint count, count x { signed id delta, uint8 type, signed unique id | string fake player name }
+//     Scores      varint objective index, varint count, count x { signed id delta, signed score }
+//     End         varint identity count, varint score count
+// Strings are a varint size and the bytes. Id deltas restart at 0 in every block. The identity of every id in a score
+// block is written in an identity block before it.
+namespace GMLIB::ScoreboardAPI {
+
+struct SnapshotObjective {
+    std::string mName;
+    std::string mDisplayName;
+    std::string mCriteria;
+};
+
+// Type values match IdentityDefinition::Type.
+struct SnapshotIdentity {
+    enum class Type : uint8_t {
+        Invalid    = 0,
+        Player     = 1,
+        Entity     = 2,
+        FakePlayer = 3
+    };
+
+    int64_t     mId;
+    Type        mType;
+    int64_t     mUniqueId = 0; // Player and Entity
+    std::string mName;         // FakePlayer
+};
+
+struct SnapshotScore {
+    int64_t mId;
+    int     mScore;
+};
+
+class ScoreSnapshotWriter {
+public:
+    static constexpr uint32_t MAGIC      = 0x53534d47; // "GMSS"
+    static constexpr uint32_t VERSION    = 1;
+    static constexpr size_t   BLOCK_SIZE = 4096;
+
+private:
+    std::ostream&                           mStream;
+    std::string                             mBuffer;
+    std::vector<SnapshotIdentity>           mIdentities;
+    std::vector<std::vector<SnapshotScore>> mScores; // Pending block of each objective
+    uint64_t                                mIdentityCount = 0;
+    uint64_t                                mScoreCount    = 0;
+
+public:
+    explicit ScoreSnapshotWriter(std::ostream& stream);
+
+public:
+    // Returns the index scores of the objective are written with.
+    uint32_t addObjective(SnapshotObjective const& objective);
+
+    void writeIdentity(SnapshotIdentity identity);
+
+    void writeScore(uint32_t objective, int64_t id, int score);
+
+    // Writes the pending blocks and the end of the snapshot. False when the stream failed.
+    bool finish();
+
+private:
+    void flushIdentities();
+
+    void flushScores(uint32_t objective);
+
+    void flushBuffer();
+};
+
+class ScoreSnapshotReader {
+public:
+    class Handler {
+    public:
+        virtual ~Handler() = default;
+
+        // Returning false stops reading.
+        virtual bool onObjective(uint32_t index, SnapshotObjective const& objective) = 0;
+
+        virtual bool onIdentities(std::vector<SnapshotIdentity> const& identities) = 0;
+
+        // One block, all scores belong to the objective.
+        virtual bool onScores(uint32_t objective, std::vector<SnapshotScore> const& scores) = 0;
+    };
+
+private:
+    std::istream& mStream;
+
+public:
+    explicit ScoreSnapshotReader(std::istream& stream);
+
+public:
+    // False on a foreign, damaged or truncated snapshot, or when the handler stopped.
+    bool read(Handler& handler);
+};
+
+} // namespace GMLIB::ScoreboardAPI
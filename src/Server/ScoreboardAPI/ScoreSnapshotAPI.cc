@@ -0,0 +1,125 @@
+#include "Global.h"
+#include "Server/ScoreboardAPI/ScoreSnapshot.h"
+#include <GMLIB/Server/ScoreboardAPI.h>
+
+namespace GMLIB::ScoreboardAPI {
+
+// Scores are applied one block at a time, but the id mapping is kept for the whole import, so its memory grows
+// with the number of identities in the snapshot.
+class ScoreSnapshotImporter : public ScoreSnapshotReader::Handler {
+public:
+    GMLIB_Scoreboard&                         mScoreboard;
+    std::vector<std::string>                  mObjectives; // By snapshot index
+    std::unordered_map<int64_t, ScoreboardId> mIds;        // Snapshot id to the id in this scoreboard
+
+public:
+    explicit ScoreSnapshotImporter(GMLIB_Scoreboard& scoreboard) : mScoreboard(scoreboard) {}
+
+public:
+    bool onObjective(uint32_t index, SnapshotObjective const& objective) override {
+        if (!mScoreboard.getObjective(objective.mName)) {
+            auto criteria = mScoreboard.getCriteria(objective.mCriteria);
+            if (!criteria) {
+                criteria = mScoreboard.getCriteria("dummy");
+            }
+            mScoreboard.addObjective(objective.mName, objective.mDisplayName, *criteria);
+        }
+        mObjectives.push_back(objective.mName);
+        return true;
+    }
+
+    bool onIdentities(std::vector<SnapshotIdentity> const& identities) override {
+        for (auto& identity : identities) {
+            ScoreboardId id = ScoreboardId::INVALID;
+            switch (identity.mType) {
+            case SnapshotIdentity::Type::Player:
+                id = mScoreboard.getScoreboardId(PlayerScoreboardId(identity.mUniqueId));
+                break;
+            case SnapshotIdentity::Type::FakePlayer:
+                id = mScoreboard.getScoreboardId(identity.mName);
+                if (!id.isValid()) {
+                    id = mScoreboard.createScoreboardId(identity.mName);
+                }
+                break;
+            default:
+                // Entity ids belong to the level they were exported from.
+                break;
+            }
+            if (id.isValid()) {
+                mIds.insert_or_assign(identity.mId, id);
+            }
+        }
+        return true;
+    }
+
+    bool onScores(uint32_t objective, std::vector<SnapshotScore> const& scores) override {
+        std::vector<ScoreChange> changes;
+        changes.reserve(scores.size());
+        for (auto& score : scores) {
+            auto it = mIds.find(score.mId);
+            if (it != mIds.end()) {
+                changes.push_back({it->second, score.mScore, PlayerScoreSetFunction::Set});
+            }
+        }
+        if (!changes.empty()) {
+            mScoreboard.setScores(mObjectives[objective], changes);
+        }
+        return true;
+    }
+};
+
+SnapshotIdentity toSnapshotIdentity(Scoreboard& scoreboard, ScoreboardId const& id) {
+    auto&            identity = scoreboard.getIdentityDefinition(id);
+    SnapshotIdentity result{id.mRawID, (SnapshotIdentity::Type)identity.getIdentityType(), 0, {}};
+    switch (identity.getIdentityType()) {
+    case IdentityDefinition::Type::Player:
+        result.mUniqueId = identity.getPlayerId().mActorUniqueId.id;
+        break;
+    case IdentityDefinition::Type::Entity:
+        result.mUniqueId = identity.getEntityId().id;
+        break;
+    case IdentityDefinition::Type::FakePlayer:
+        result.mName = identity.getFakePlayerName();
+        break;
+    default:
+        break;
+    }
+    return result;
+}
+
+} // namespace GMLIB::ScoreboardAPI
+
+bool GMLIB_Scoreboard::exportScores(std::string const& path) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    GMLIB::ScoreboardAPI::ScoreSnapshotWriter      writer(file);
+    std::unordered_map<Objective const*, uint32_t> objectives;
+    for (auto objective : getObjectives()) {
+        objectives.emplace(
+            objective,
+            writer.addObjective({objective->getName(), objective->getDisplayName(), objective->getCriteria().getName()})
+        );
+    }
+    // Scores are read per id, each objective's scores are buffered up to one block.
+    for (auto& id : getTrackedIds()) {
+        writer.writeIdentity(GMLIB::ScoreboardAPI::toSnapshotIdentity(*this, id));
+        for (auto& score : getIdScores(id)) {
+            auto it = objectives.find(score.mObjective);
+            if (it != objectives.end()) {
+                writer.writeScore(it->second, id.mRawID, score.mScore);
+            }
+        }
+    }
+    return writer.finish();
+}
+
+bool GMLIB_Scoreboard::importScores(std::string const& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    GMLIB::ScoreboardAPI::ScoreSnapshotImporter importer(*this);
+    return GMLIB::ScoreboardAPI::ScoreSnapshotReader(file).read(importer);
+}
@@ -0,0 +1,370 @@
+#include "Global.h"
+#include "Server/UserCache/UserCacheJournal.h"
+#include "Server/UserCache/UserNameIndex.h"
+#include <GMLIB/Server/UserCache.h>
+#include <shared_mutex>
+
+namespace GMLIB::Server::UserCache {
+
+constexpr auto USER_CACHE_JSON_PATH    = "./usercache.json";
+constexpr auto USER_CACHE_BINARY_PATH  = "./usercache.bin";
+constexpr auto USER_CACHE_JOURNAL_PATH = "./usercache.journal";
+
+// With a binary snapshot mUserCache only holds the records changed since it was written,
+// and takes precedence over mUserCacheImage.
+UserCacheTable                    mUserCache;
+UserCacheImage                    mUserCacheImage;
+std::unique_ptr<UserCacheJournal> mUserCacheJournal;
+// Built by the first search, so that startup does not pay for it.
+UserNameIndex                     mUserNameIndex;
+bool                              mUserNameIndexBuilt = false;
+// Readers share mUserCacheMutex, updates are queued in mPendingRecords and published in batches
+// by the server thread, so that a login never waits for a reader.
+std::shared_mutex                 mUserCacheMutex;
+std::mutex                        mPendingMutex;
+std::vector<UserCacheRecord>      mPendingRecords;
+// Ticks in a row in which readers kept the cache locked, publishing waits for them after the limit.
+std::atomic<uint>                 mPublishRetries = 0;
+
+constexpr uint   PUBLISH_RETRY_LIMIT  = 20;
+constexpr size_t PUBLISH_PENDING_SIZE = 4096;
+
+void initUserCache() {
+    std::unique_lock lock(mUserCacheMutex);
+    auto             format = UserCacheFormat::Json;
+    if (std::filesystem::exists(USER_CACHE_BINARY_PATH)) {
+        if (mUserCacheImage.open(USER_CACHE_BINARY_PATH)) {
+            format = UserCacheFormat::Binary;
+            // Reopened after start(), which may replace the file.
+            mUserCacheImage.close();
+        } else {
+            logger.error("Failed to open {}, falling back to {}", USER_CACHE_BINARY_PATH, USER_CACHE_JSON_PATH);
+        }
+    }
+    mUserCacheJournal = std::make_unique<UserCacheJournal>(
+        USER_CACHE_JSON_PATH,
+        USER_CACHE_BINARY_PATH,
+        USER_CACHE_JOURNAL_PATH,
+        4096,
+        format
+    );
+    mUserCacheJournal->load(mUserCache);
+    mUserCacheJournal->start();
+    if (format == UserCacheFormat::Binary && !mUserCacheImage.open(USER_CACHE_BINARY_PATH)) {
+        logger.error("Failed to open {}", USER_CACHE_BINARY_PATH);
+    }
+}
+
+void flushUserCache() {
+    publishUserCache(true);
+    std::unique_lock lock(mUserCacheMutex);
+    // The journal may replace the mapped file.
+    mUserCacheImage.close();
+    if (mUserCacheJournal) {
+        mUserCacheJournal->stop();
+    }
+}
+
+UserCacheRecordView toView(UserCacheRecord const& record) { return {record.mUuid, record.mXuid, record.mRealName}; }
+
+std::optional<UserCacheRecordView> findRecordByUuid(std::string_view uuid) {
+    if (auto record = mUserCache.tryGetByUuid(uuid)) {
+        return toView(*record);
+    }
+    auto index = mUserCacheImage.findByUuid(uuid);
+    if (index != UserCacheImage::npos) {
+        return mUserCacheImage.at(index);
+    }
+    return {};
+}
+
+// An image hit is stale when the same player has been updated since.
+std::optional<UserCacheRecordView> checkImageRecord(size_t index) {
+    if (index == UserCacheImage::npos) {
+        return {};
+    }
+    auto record = mUserCacheImage.at(index);
+    if (mUserCache.findByUuid(record.mUuid) != UserCacheTable::npos) {
+        return {};
+    }
+    return record;
+}
+
+std::optional<UserCacheRecordView> findRecordByXuid(std::string_view xuid) {
+    if (auto record = mUserCache.tryGetByXuid(xuid)) {
+        return toView(*record);
+    }
+    return checkImageRecord(mUserCacheImage.findByXuid(xuid));
+}
+
+std::optional<UserCacheRecordView> findRecordByName(std::string_view name) {
+    if (auto record = mUserCache.tryGetByName(name)) {
+        return toView(*record);
+    }
+    // The image keeps every holder of the name, the ones updated since are skipped.
+    auto index = mUserCacheImage.findByName(name, [](size_t index) {
+        return mUserCache.findByUuid(mUserCacheImage.at(index).mUuid) == UserCacheTable::npos;
+    });
+    if (index == UserCacheImage::npos) {
+        return {};
+    }
+    return mUserCacheImage.at(index);
+}
+
+template <typename T>
+void forEachRecord(T&& callback) {
+    for (size_t i = 0; i < mUserCacheImage.size(); i++) {
+        auto record = mUserCacheImage.at(i);
+        if (mUserCache.findByUuid(record.mUuid) == UserCacheTable::npos) {
+            callback(record);
+        }
+    }
+    for (auto& record : mUserCache.getRecords()) {
+        callback(toView(record));
+    }
+}
+
+void applyRecord(UserCacheRecord& record) {
+    auto current = findRecordByUuid(record.mUuid);
+    if (current && current->mXuid == record.mXuid && current->mRealName == record.mRealName) {
+        return;
+    }
+    mUserCache.update(record.mUuid, record.mXuid, record.mRealName);
+    if (mUserNameIndexBuilt) {
+        mUserNameIndex.update(record.mUuid, record.mRealName);
+    }
+    if (mUserCacheJournal) {
+        mUserCacheJournal->append(std::move(record));
+    }
+}
+
+void publishUserCache(bool wait) {
+    if (!wait) {
+        std::lock_guard pendingLock(mPendingMutex);
+        if (mPendingRecords.empty()) {
+            return;
+        }
+        // Readers that never release the cache would delay the records forever.
+        wait = mPublishRetries >= PUBLISH_RETRY_LIMIT || mPendingRecords.size() >= PUBLISH_PENDING_SIZE;
+    }
+    std::unique_lock lock(mUserCacheMutex, std::defer_lock);
+    if (wait) {
+        lock.lock();
+    } else if (!lock.try_lock()) {
+        // A reader holds the cache, retried on the next tick.
+        mPublishRetries++;
+        return;
+    }
+    mPublishRetries = 0;
+    std::vector<UserCacheRecord> records;
+    {
+        std::lock_guard pendingLock(mPendingMutex);
+        records.swap(mPendingRecords);
+    }
+    for (auto& record : records) {
+        applyRecord(record);
+    }
+}
+
+void updateRecord(std::string_view uuid, std::string_view xuid, std::string_view realName) {
+    UserCacheRecord record{std::string(uuid), std::string(xuid), std::string(realName)};
+    std::lock_guard lock(mPendingMutex);
+    mPendingRecords.push_back(std::move(record));
+}
+
+void updateUserCache(mce::UUID& uuid, std::string& xuid, std::string& realName) {
+    updateRecord(uuid.asString(), xuid, realName);
+}
+
+std::optional<UserCacheInfo> toInfo(std::optional<UserCacheRecordView> const& record) {
+    if (!record) {
+        return {};
+    }
+    return UserCacheInfo{std::string(record->mUuid), std::string(record->mXuid), std::string(record->mRealName)};
+}
+
+std::optional<nlohmann::json> toJson(std::optional<UserCacheRecordView> const& record) {
+    if (!record) {
+        return {};
+    }
+    return toJson(*record);
+}
+
+std::optional<std::string>
+toString(std::optional<UserCacheRecordView> const& record, std::string_view UserCacheRecordView::*field) {
+    if (!record) {
+        return {};
+    }
+    return std::string((*record).*field);
+}
+
+std::optional<nlohmann::json> tryFindCahceInfoFromUuid(std::string& uuid) {
+    std::shared_lock lock(mUserCacheMutex);
+    return toJson(findRecordByUuid(uuid));
+}
+
+std::optional<nlohmann::json> tryFindCahceInfoFromXuid(std::string& xuid) {
+    std::shared_lock lock(mUserCacheMutex);
+    return toJson(findRecordByXuid(xuid));
+}
+
+std::optional<nlohmann::json> tryFindCahceInfoFromName(std::string& name) {
+    std::shared_lock lock(mUserCacheMutex);
+    return toJson(findRecordByName(name));
+}
+
+std::optional<UserCacheInfo> tryFindCacheInfoByUuid(std::string_view uuid) {
+    std::shared_lock lock(mUserCacheMutex);
+    return toInfo(findRecordByUuid(uuid));
+}
+
+std::optional<UserCacheInfo> tryFindCacheInfoByXuid(std::string_view xuid) {
+    std::shared_lock lock(mUserCacheMutex);
+    return toInfo(findRecordByXuid(xuid));
+}
+
+std::optional<UserCacheInfo> tryFindCacheInfoByName(std::string_view name) {
+    std::shared_lock lock(mUserCacheMutex);
+    return toInfo(findRecordByName(name));
+}
+
+size_t getUserCacheSize() {
+    std::shared_lock lock(mUserCacheMutex);
+    size_t           size = mUserCacheImage.size();
+    for (auto& record : mUserCache.getRecords()) {
+        if (mUserCacheImage.findByUuid(record.mUuid) == UserCacheImage::npos) {
+            size++;
+        }
+    }
+    return size;
+}
+
+std::optional<std::string> getXuidByUuid(std::string& uuid) {
+    std::shared_lock lock(mUserCacheMutex);
+    return toString(findRecordByUuid(uuid), &UserCacheRecordView::mXuid);
+}
+
+std::optional<std::string> getNameByUuid(std::string& uuid) {
+    std::shared_lock lock(mUserCacheMutex);
+    return toString(findRecordByUuid(uuid), &UserCacheRecordView::mRealName);
+}
+
+std::optional<std::string> getUuidByXuid(std::string& xuid) {
+    std::shared_lock lock(mUserCacheMutex);
+    return toString(findRecordByXuid(xuid), &UserCacheRecordView::mUuid);
+}
+
+std::optional<std::string> getNameByXuid(std::string& xuid) {
+    std::shared_lock lock(mUserCacheMutex);
+    return toString(findRecordByXuid(xuid), &UserCacheRecordView::mRealName);
+}
+
+std::optional<std::string> getXuidByName(std::string& name) {
+    std::shared_lock lock(mUserCacheMutex);
+    return toString(findRecordByName(name), &UserCacheRecordView::mXuid);
+}
+
+std::optional<std::string> getUuidByName(std::string& name) {
+    std::shared_lock lock(mUserCacheMutex);
+    return toString(findRecordByName(name), &UserCacheRecordView::mUuid);
+}
+
+std::vector<UserCacheInfo> toInfoList(std::vector<std::string> const& uuids) {
+    std::vector<UserCacheInfo> result;
+    result.reserve(uuids.size());
+    for (auto& uuid : uuids) {
+        if (auto info = toInfo(findRecordByUuid(uuid))) {
+            result.push_back(std::move(*info));
+        }
+    }
+    return result;
+}
+
+template <typename T>
+std::vector<UserCacheInfo> searchUserNameIndex(T&& search) {
+    {
+        std::shared_lock lock(mUserCacheMutex);
+        if (mUserNameIndexBuilt) {
+            return toInfoList(search(mUserNameIndex));
+        }
+    }
+    std::unique_lock lock(mUserCacheMutex);
+    if (!mUserNameIndexBuilt) {
+        forEachRecord([](UserCacheRecordView const& record) {
+            mUserNameIndex.update(record.mUuid, record.mRealName);
+        });
+        mUserNameIndexBuilt = true;
+    }
+    return toInfoList(search(mUserNameIndex));
+}
+
+std::vector<UserCacheInfo> searchUserCacheByNamePrefix(std::string_view prefix, size_t limit) {
+    return searchUserNameIndex([&](UserNameIndex& index) { return index.findByPrefix(prefix, limit); });
+}
+
+std::vector<UserCacheInfo> searchUserCacheByName(std::string_view name, size_t limit, size_t maxDistance) {
+    return searchUserNameIndex([&](UserNameIndex& index) { return index.findSimilar(name, limit, maxDistance); });
+}
+
+bool exportUserCacheToJson(std::string const& path) {
+    try {
+        std::shared_lock lock(mUserCacheMutex);
+        auto             data = nlohmann::json::array();
+        forEachRecord([&](UserCacheRecordView const& record) { data.push_back(toJson(record)); });
+        std::ofstream file(path, std::ios::trunc);
+        file << data.dump(4);
+        file.close();
+        return !file.fail();
+    } catch (...) {
+        return false;
+    }
+}
+
+bool importUserCacheFromJson(std::string const& path) {
+    try {
+        std::ifstream file(path);
+        auto          data = nlohmann::json::parse(file, nullptr, true, true);
+        for (auto& info : data) {
+            updateRecord(
+                info.at("uuid").get<std::string>(),
+                info.value("xuid", std::string()),
+                info.value("realName", std::string())
+            );
+        }
+        // Visible to lookups once this returns.
+        publishUserCache(true);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+void setUserCacheBinaryFormat(bool value) {
+    if (mUserCacheJournal) {
+        mUserCacheJournal->setFormat(value ? UserCacheFormat::Binary : UserCacheFormat::Json);
+    }
+}
+
+bool isUserCacheBinaryFormat() {
+    return mUserCacheJournal && mUserCacheJournal->getFormat() == UserCacheFormat::Binary;
+}
+
+} // namespace GMLIB::Server::UserCache
+
+LL_AUTO_TYPE_INSTANCE_HOOK(
+    PlayerLoginHook,
+    ll::memory::HookPriority::Lowest,
+    ServerNetworkHandler,
+    "?handle@ServerNetworkHandler@@UEAAXAEBVNetworkIdentifier@@AEBVLoginPacket@@@Z",
+    void,
+    class NetworkIdentifier const& source,
+    class LoginPacket const&       packet
+) {
+    GMLIB_PROFILE_HOOK(PlayerLoginHook);
+    GMLIB_PROFILE_ORIGIN(origin(source, packet));
+    auto cert     = packet.mConnectionRequest->getCertificate();
+    auto uuid     = ExtendedCertificate::getIdentity(*cert);
+    auto xuid     = ExtendedCertificate::getXuid(*cert, false);
+    auto realName = ExtendedCertificate::getIdentityName(*cert);
+    GMLIB::Server::UserCache::updateUserCache(uuid, xuid, realName);
+}
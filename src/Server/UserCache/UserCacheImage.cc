@@ -0,0 +1,298 @@
+#include "Server/UserCache/UserCacheImage.h"
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace GMLIB::Server::UserCache {
+
+inline uint64_t hashKey(std::string_view key) {
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    for (auto c : key) {
+        hash ^= (uint8_t)c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+UserCacheImage::~UserCacheImage() { close(); }
+
+bool UserCacheImage::open(std::filesystem::path const& path) {
+    close();
+#ifdef _WIN32
+    auto file = CreateFileW(
+        path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS,
+        nullptr
+    );
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(Header)) {
+        CloseHandle(file);
+        return false;
+    }
+    auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+    auto data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    mFile    = file;
+    mMapping = mapping;
+    mData    = (char const*)data;
+    mSize    = (size_t)fileSize.QuadPart;
+#else
+    auto file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+        return false;
+    }
+    struct stat fileStat;
+    if (fstat(file, &fileStat) != 0 || fileStat.st_size < (off_t)sizeof(Header)) {
+        ::close(file);
+        return false;
+    }
+    auto data = mmap(nullptr, (size_t)fileStat.st_size, PROT_READ, MAP_SHARED, file, 0);
+    ::close(file);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+    mData = (char const*)data;
+    mSize = (size_t)fileStat.st_size;
+#endif
+    mHeader            = (Header const*)mData;
+    auto indexBytes    = (uint64_t)mHeader->mIndexCapacity * sizeof(uint32_t);
+    auto checkSection  = [&](uint64_t offset, uint64_t size) { return offset <= mSize && size <= mSize - offset; };
+    bool validCapacity = mHeader->mIndexCapacity != 0
+                      && (mHeader->mIndexCapacity & (mHeader->mIndexCapacity - 1)) == 0
+                      && mHeader->mIndexCapacity > mHeader->mRecordCount;
+    if (mHeader->mMagic != MAGIC || mHeader->mVersion != VERSION || !validCapacity
+        || !checkSection(mHeader->mRecordsOffset, (uint64_t)mHeader->mRecordCount * sizeof(Record))
+        || !checkSection(mHeader->mArenaOffset, mHeader->mArenaSize)
+        || !checkSection(mHeader->mUuidIndexOffset, indexBytes) || !checkSection(mHeader->mXuidIndexOffset, indexBytes)
+        || !checkSection(mHeader->mNameIndexOffset, indexBytes) || mHeader->mRecordsOffset % alignof(Record) != 0
+        || mHeader->mUuidIndexOffset % 4 != 0 || mHeader->mXuidIndexOffset % 4 != 0
+        || mHeader->mNameIndexOffset % 4 != 0) {
+        close();
+        return false;
+    }
+    mRecords   = (Record const*)(mData + mHeader->mRecordsOffset);
+    mUuidIndex = (uint32_t const*)(mData + mHeader->mUuidIndexOffset);
+    mXuidIndex = (uint32_t const*)(mData + mHeader->mXuidIndexOffset);
+    mNameIndex = (uint32_t const*)(mData + mHeader->mNameIndexOffset);
+    return true;
+}
+
+void UserCacheImage::close() {
+#ifdef _WIN32
+    if (mData) {
+        UnmapViewOfFile(mData);
+    }
+    if (mMapping) {
+        CloseHandle(mMapping);
+    }
+    if (mFile) {
+        CloseHandle(mFile);
+    }
+#else
+    if (mData) {
+        munmap((void*)mData, mSize);
+    }
+#endif
+    mFile      = nullptr;
+    mMapping   = nullptr;
+    mData      = nullptr;
+    mSize      = 0;
+    mHeader    = nullptr;
+    mRecords   = nullptr;
+    mUuidIndex = nullptr;
+    mXuidIndex = nullptr;
+    mNameIndex = nullptr;
+}
+
+bool UserCacheImage::isOpen() const { return mData != nullptr; }
+
+size_t UserCacheImage::size() const { return mHeader ? mHeader->mRecordCount : 0; }
+
+std::string_view UserCacheImage::getString(uint32_t offset, uint32_t size) const {
+    // A corrupted record reads as empty instead of out of bounds.
+    if ((uint64_t)offset + size > mHeader->mArenaSize) {
+        return {};
+    }
+    return std::string_view(mData + mHeader->mArenaOffset + offset, size);
+}
+
+UserCacheRecordView UserCacheImage::at(size_t index) const {
+    if (index >= size()) {
+        return {};
+    }
+    auto& record = mRecords[index];
+    return {
+        getString(record.mUuidOffset, record.mUuidSize),
+        getString(record.mXuidOffset, record.mXuidSize),
+        getString(record.mNameOffset, record.mNameSize)
+    };
+}
+
+size_t UserCacheImage::find(
+    uint32_t const*                          index,
+    std::string_view                         key,
+    std::string_view UserCacheRecordView::*field,
+    std::function<bool(size_t index)> const& accept
+) const {
+    if (!index || key.empty()) {
+        return npos;
+    }
+    auto mask = (uint64_t)mHeader->mIndexCapacity - 1;
+    auto slot = hashKey(key) & mask;
+    // A damaged index may have no empty slot, so a miss stops after one full pass.
+    for (uint64_t probe = 0; probe < mHeader->mIndexCapacity; probe++, slot = (slot + 1) & mask) {
+        auto value = index[slot];
+        if (value == 0 || value > mHeader->mRecordCount) {
+            return npos;
+        }
+        if (at(value - 1).*field == key && (!accept || accept(value - 1))) {
+            return value - 1;
+        }
+    }
+    return npos;
+}
+
+size_t UserCacheImage::findByUuid(std::string_view uuid) const {
+    return find(mUuidIndex, uuid, &UserCacheRecordView::mUuid);
+}
+
+size_t UserCacheImage::findByXuid(std::string_view xuid) const {
+    return find(mXuidIndex, xuid, &UserCacheRecordView::mXuid);
+}
+
+size_t UserCacheImage::findByName(std::string_view name, std::function<bool(size_t index)> const& accept) const {
+    return find(mNameIndex, name, &UserCacheRecordView::mRealName, accept);
+}
+
+bool UserCacheImage::write(std::filesystem::path const& path, std::vector<UserCacheRecordView> const& records) {
+    if (records.size() >= UINT32_MAX / 2) {
+        return false;
+    }
+    uint32_t capacity = 16;
+    while (capacity < records.size() * 2) {
+        capacity <<= 1;
+    }
+    std::vector<Record>   table(records.size());
+    std::string           arena;
+    std::vector<uint32_t> uuidIndex(capacity, 0);
+    std::vector<uint32_t> xuidIndex(capacity, 0);
+    std::vector<uint32_t> nameIndex(capacity, 0);
+
+    auto appendString = [&](std::string_view value, uint32_t& offset, uint32_t& size) {
+        offset  = (uint32_t)arena.size();
+        size    = (uint32_t)value.size();
+        arena  += value;
+    };
+    auto insertKey = [&](std::vector<uint32_t>& index, std::string_view key, uint32_t position, auto field, bool all) {
+        if (key.empty()) {
+            return;
+        }
+        for (auto slot = hashKey(key) & (capacity - 1);; slot = (slot + 1) & (capacity - 1)) {
+            if (index[slot] == 0) {
+                index[slot] = position + 1;
+                return;
+            }
+            // Inserted from the last record, so a duplicated key is already held by the record that wins.
+            if (!all && records[index[slot] - 1].*field == key) {
+                return;
+            }
+        }
+    };
+    for (uint32_t i = 0; i < (uint32_t)records.size(); i++) {
+        auto& record = records[i];
+        appendString(record.mUuid, table[i].mUuidOffset, table[i].mUuidSize);
+        appendString(record.mXuid, table[i].mXuidOffset, table[i].mXuidSize);
+        appendString(record.mRealName, table[i].mNameOffset, table[i].mNameSize);
+        if (arena.size() > UINT32_MAX) {
+            return false;
+        }
+    }
+    // Every holder of a name is kept, the last written first in its probe chain.
+    for (auto i = (uint32_t)records.size(); i-- > 0;) {
+        insertKey(uuidIndex, records[i].mUuid, i, &UserCacheRecordView::mUuid, false);
+        insertKey(xuidIndex, records[i].mXuid, i, &UserCacheRecordView::mXuid, false);
+        insertKey(nameIndex, records[i].mRealName, i, &UserCacheRecordView::mRealName, true);
+    }
+    auto   align     = [](uint64_t offset) { return (offset + 7) & ~7ull; };
+    auto   indexSize = (uint64_t)capacity * sizeof(uint32_t);
+    Header header{};
+    header.mMagic           = MAGIC;
+    header.mVersion         = VERSION;
+    header.mRecordCount     = (uint32_t)records.size();
+    header.mIndexCapacity   = capacity;
+    header.mRecordsOffset   = align(sizeof(Header));
+    header.mArenaOffset     = header.mRecordsOffset + table.size() * sizeof(Record);
+    header.mArenaSize       = arena.size();
+    header.mUuidIndexOffset = align(header.mArenaOffset + header.mArenaSize);
+    header.mXuidIndexOffset = header.mUuidIndexOffset + indexSize;
+    header.mNameIndexOffset = header.mXuidIndexOffset + indexSize;
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    char padding[8] = {};
+    file.write((char const*)&header, sizeof(Header));
+    file.write(padding, header.mRecordsOffset - sizeof(Header));
+    file.write((char const*)table.data(), table.size() * sizeof(Record));
+    file.write(arena.data(), arena.size());
+    file.write(padding, header.mUuidIndexOffset - header.mArenaOffset - header.mArenaSize);
+    file.write((char const*)uuidIndex.data(), indexSize);
+    file.write((char const*)xuidIndex.data(), indexSize);
+    file.write((char const*)nameIndex.data(), indexSize);
+    file.close();
+    return !file.fail();
+}
+
+bool UserCacheImage::syncFile(std::filesystem::path const& path) {
+#ifdef _WIN32
+    auto file =
+        CreateFileW(path.c_str(), GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    auto result = FlushFileBuffers(file) != 0;
+    CloseHandle(file);
+    return result;
+#else
+    auto file = ::open(path.c_str(), O_RDWR);
+    if (file < 0) {
+        return false;
+    }
+    auto result = fsync(file) == 0;
+    ::close(file);
+    return result;
+#endif
+}
+
+} // namespace GMLIB::Server::UserCache
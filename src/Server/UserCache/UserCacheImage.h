@@ -0,0 +1,111 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+// Engine independent. Binary user cache file, mapped read-only and queried in place without parsing.
+//
+// Layout (little endian, offsets from the start of the file):
+//   Header
+//   Record[mRecordCount]           offsets into the string arena
+//   string arena
+//   uint32[mIndexCapacity] x 3     open addressing hash indexes (uuid, xuid, name), slot = record index + 1,
+//                                  the name index keeps every record of a name, the last one first
+namespace GMLIB::Server::UserCache {
+
+struct UserCacheRecordView {
+    std::string_view mUuid;
+    std::string_view mXuid;
+    std::string_view mRealName;
+};
+
+class UserCacheImage {
+public:
+    static constexpr size_t   npos    = (size_t)-1;
+    static constexpr uint32_t MAGIC   = 0x43554d47; // "GMUC"
+    static constexpr uint32_t VERSION = 1;
+
+    struct Header {
+        uint32_t mMagic;
+        uint32_t mVersion;
+        uint32_t mRecordCount;
+        uint32_t mIndexCapacity;
+        uint64_t mRecordsOffset;
+        uint64_t mArenaOffset;
+        uint64_t mArenaSize;
+        uint64_t mUuidIndexOffset;
+        uint64_t mXuidIndexOffset;
+        uint64_t mNameIndexOffset;
+    };
+
+    struct Record {
+        uint32_t mUuidOffset;
+        uint32_t mUuidSize;
+        uint32_t mXuidOffset;
+        uint32_t mXuidSize;
+        uint32_t mNameOffset;
+        uint32_t mNameSize;
+    };
+
+private:
+    void*           mFile      = nullptr;
+    void*           mMapping   = nullptr;
+    char const*     mData      = nullptr;
+    size_t          mSize      = 0;
+    Header const*   mHeader    = nullptr;
+    Record const*   mRecords   = nullptr;
+    uint32_t const* mUuidIndex = nullptr;
+    uint32_t const* mXuidIndex = nullptr;
+    uint32_t const* mNameIndex = nullptr;
+
+public:
+    UserCacheImage() = default;
+
+    UserCacheImage(UserCacheImage const&)            = delete;
+    UserCacheImage& operator=(UserCacheImage const&) = delete;
+
+    ~UserCacheImage();
+
+public:
+    // Fails on a missing, truncated or foreign file.
+    bool open(std::filesystem::path const& path);
+
+    void close();
+
+    bool isOpen() const;
+
+    size_t size() const;
+
+    UserCacheRecordView at(size_t index) const;
+
+    size_t findByUuid(std::string_view uuid) const;
+
+    size_t findByXuid(std::string_view xuid) const;
+
+    // Last written record wins for duplicated names. Records rejected by accept are skipped, so that a caller holding
+    // newer records can fall back to the other holders of the name.
+    size_t findByName(std::string_view name, std::function<bool(size_t index)> const& accept = {}) const;
+
+public:
+    // Writes a complete image, empty xuid and name keys are not indexed.
+    static bool write(std::filesystem::path const& path, std::vector<UserCacheRecordView> const& records);
+
+    // Flushes a written file to the disk, so a rename over the old file cannot leave it empty after a crash.
+    static bool syncFile(std::filesystem::path const& path);
+
+private:
+    std::string_view getString(uint32_t offset, uint32_t size) const;
+
+    // The first record of the probe chain with the key that accept does not reject.
+    size_t find(
+        uint32_t const*                          index,
+        std::string_view                         key,
+        std::string_view UserCacheRecordView::*field,
+        std::function<bool(size_t index)> const& accept = {}
+    ) const;
+};
+
+} // namespace GMLIB::Server::UserCache
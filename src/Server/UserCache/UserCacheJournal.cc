@@ -0,0 +1,245 @@
+#include "Server/UserCache/UserCacheJournal.h"
+#include "Global.h"
+
+namespace GMLIB::Server::UserCache {
+
+nlohmann::json toJson(UserCacheRecordView const& record) {
+    return {
+        {"uuid",     record.mUuid    },
+        {"xuid",     record.mXuid    },
+        {"realName", record.mRealName}
+    };
+}
+
+bool applyJson(UserCacheTable& table, nlohmann::json const& info) {
+    return table.update(
+        info.at("uuid").get<std::string>(),
+        info.value("xuid", std::string()),
+        info.value("realName", std::string())
+    );
+}
+
+UserCacheJournal::UserCacheJournal(
+    std::filesystem::path jsonPath,
+    std::filesystem::path binaryPath,
+    std::filesystem::path journalPath,
+    size_t                compactThreshold,
+    UserCacheFormat       format
+)
+: mJsonPath(std::move(jsonPath)),
+  mBinaryPath(std::move(binaryPath)),
+  mJournalPath(std::move(journalPath)),
+  mCompactThreshold(compactThreshold),
+  mSnapshotMapped(format == UserCacheFormat::Binary),
+  mFormat(format),
+  mBaseFormat(format) {}
+
+UserCacheJournal::~UserCacheJournal() { stop(); }
+
+void UserCacheJournal::load(UserCacheTable& table) {
+    table.clear();
+    mMirror.clear();
+    if (mBaseFormat == UserCacheFormat::Json && std::filesystem::exists(mJsonPath)) {
+        try {
+            std::ifstream file(mJsonPath);
+            auto          data = nlohmann::json::parse(file, nullptr, true, true);
+            table.reserve(data.size());
+            mMirror.reserve(data.size());
+            for (auto& info : data) {
+                try {
+                    applyJson(table, info);
+                    applyJson(mMirror, info);
+                } catch (...) {}
+            }
+        } catch (...) {
+            // Keep the broken file, the next compaction replaces the snapshot.
+            logger.error("Failed to load {}, a copy is kept as .bak", mJsonPath.string());
+            std::error_code ec;
+            auto            backup = mJsonPath;
+            std::filesystem::copy_file(
+                mJsonPath,
+                backup += ".bak",
+                std::filesystem::copy_options::overwrite_existing,
+                ec
+            );
+        }
+    }
+    mJournalEntries = 0;
+    mJournalSize    = 0;
+    mJournalValid   = 0;
+    std::error_code ec;
+    if (std::filesystem::exists(mJournalPath, ec)) {
+        mJournalSize = std::filesystem::file_size(mJournalPath, ec);
+        std::ifstream file(mJournalPath, std::ios::binary);
+        std::string   line;
+        while (std::getline(file, line)) {
+            // A line without its newline was cut by a crash, even if it parses.
+            if (file.eof()) {
+                break;
+            }
+            if (!line.empty()) {
+                try {
+                    auto info = nlohmann::json::parse(line);
+                    applyJson(table, info);
+                    applyJson(mMirror, info);
+                    mJournalEntries++;
+                } catch (...) {
+                    // A torn line can only be the last one, written during a crash.
+                    break;
+                }
+            }
+            mJournalValid += line.size() + 1;
+        }
+    }
+}
+
+void UserCacheJournal::start() {
+    if (mThread.joinable()) {
+        return;
+    }
+    // Fold a replayed journal into the snapshot first, a torn tail would break later appends.
+    if (mJournalSize > 0 && !compact() && mJournalValid < mJournalSize) {
+        std::error_code ec;
+        std::filesystem::resize_file(mJournalPath, mJournalValid, ec);
+        if (ec) {
+            logger.error("Failed to truncate {}", mJournalPath.string());
+        }
+    }
+    mJournal.open(mJournalPath, std::ios::app | std::ios::binary);
+    if (!mJournal.is_open()) {
+        logger.error("Failed to open {}", mJournalPath.string());
+    }
+    mStopping = false;
+    mThread   = std::thread([this] { run(); });
+}
+
+void UserCacheJournal::append(UserCacheRecord record) {
+    {
+        std::lock_guard lock(mMutex);
+        mPending.push_back(std::move(record));
+    }
+    mCondition.notify_one();
+}
+
+void UserCacheJournal::stop() {
+    if (!mThread.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard lock(mMutex);
+        mStopping = true;
+    }
+    mCondition.notify_one();
+    mThread.join();
+}
+
+void UserCacheJournal::run() {
+    std::unique_lock lock(mMutex);
+    while (true) {
+        mCondition.wait(lock, [this] { return mStopping || !mPending.empty(); });
+        auto records  = std::move(mPending);
+        auto stopping = mStopping;
+        mPending.clear();
+        lock.unlock();
+        writeRecords(records);
+        if ((!mSnapshotMapped && mJournalEntries >= mCompactThreshold)
+            || (stopping && (mJournalEntries > 0 || mFormat != mBaseFormat))) {
+            compact();
+        }
+        lock.lock();
+        if (stopping && mPending.empty()) {
+            break;
+        }
+    }
+    mJournal.close();
+}
+
+void UserCacheJournal::writeRecords(std::vector<UserCacheRecord> const& records) {
+    for (auto& record : records) {
+        if (!mMirror.update(record.mUuid, record.mXuid, record.mRealName)) {
+            continue;
+        }
+        mJournal << toJson({record.mUuid, record.mXuid, record.mRealName}).dump() << '\n';
+        mJournalEntries++;
+    }
+    mJournal.flush();
+}
+
+void UserCacheJournal::setFormat(UserCacheFormat format) { mFormat = format; }
+
+UserCacheFormat UserCacheJournal::getFormat() const { return mFormat; }
+
+bool UserCacheJournal::writeSnapshot(
+    std::filesystem::path const& path,
+    UserCacheFormat              format,
+    UserCacheImage const&        base
+) {
+    std::vector<UserCacheRecordView> records;
+    records.reserve(base.size() + mMirror.size());
+    for (size_t i = 0; i < base.size(); i++) {
+        auto record = base.at(i);
+        if (mMirror.findByUuid(record.mUuid) == UserCacheTable::npos) {
+            records.push_back(record);
+        }
+    }
+    for (auto& record : mMirror.getRecords()) {
+        records.push_back({record.mUuid, record.mXuid, record.mRealName});
+    }
+    if (format == UserCacheFormat::Binary) {
+        return UserCacheImage::write(path, records) && UserCacheImage::syncFile(path);
+    }
+    auto data = nlohmann::json::array();
+    for (auto& record : records) {
+        data.push_back(toJson(record));
+    }
+    std::ofstream file(path, std::ios::trunc | std::ios::binary);
+    file << data.dump(4);
+    file.close();
+    return !file.fail() && UserCacheImage::syncFile(path);
+}
+
+bool UserCacheJournal::compact() {
+    UserCacheImage base;
+    if (mBaseFormat == UserCacheFormat::Binary) {
+        base.open(mBinaryPath);
+    }
+    auto format    = mFormat.load();
+    auto path      = format == UserCacheFormat::Binary ? mBinaryPath : mJsonPath;
+    auto tempPath  = path;
+    tempPath      += ".tmp";
+    try {
+        if (!writeSnapshot(tempPath, format, base)) {
+            throw std::runtime_error("write failed");
+        }
+        if (format == UserCacheFormat::Json) {
+            // A json base needs a complete mirror.
+            for (size_t i = 0; i < base.size(); i++) {
+                auto record = base.at(i);
+                if (mMirror.findByUuid(record.mUuid) == UserCacheTable::npos) {
+                    mMirror.update(record.mUuid, record.mXuid, record.mRealName);
+                }
+            }
+        }
+        base.close();
+        std::filesystem::rename(tempPath, path);
+    } catch (...) {
+        logger.error("Failed to compact {}", path.string());
+        return false;
+    }
+    if (format != mBaseFormat) {
+        std::error_code ec;
+        std::filesystem::remove(mBaseFormat == UserCacheFormat::Binary ? mBinaryPath : mJsonPath, ec);
+        mBaseFormat = format;
+    }
+    // Replaying the journal over the new snapshot is harmless, so a crash before the truncation loses nothing.
+    auto reopen = mJournal.is_open();
+    mJournal.close();
+    mJournal.open(mJournalPath, std::ios::trunc | std::ios::binary);
+    if (!reopen) {
+        mJournal.close();
+    }
+    mJournalEntries = 0;
+    return true;
+}
+
+} // namespace GMLIB::Server::UserCache
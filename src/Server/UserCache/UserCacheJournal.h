@@ -0,0 +1,89 @@
+#pragma once
+#include "Server/UserCache/UserCacheImage.h"
+#include "Server/UserCache/UserCacheTable.h"
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <thread>
+#include <vector>
+
+namespace GMLIB::Server::UserCache {
+
+extern nlohmann::json toJson(UserCacheRecordView const& record);
+
+enum class UserCacheFormat {
+    Json,
+    Binary,
+};
+
+// Write-behind persistence: changes are appended to a journal (one json object per line) by a background
+// thread, which folds the journal into the snapshot once it grows past the compact threshold.
+// The snapshot is either usercache.json or a binary image, and is replaced by an atomic rename.
+// A binary snapshot is mapped by the caller, the journal is then an overlay which is only merged at start()
+// and stop(), because a mapped file cannot be replaced on Windows.
+class UserCacheJournal {
+private:
+    std::filesystem::path        mJsonPath;
+    std::filesystem::path        mBinaryPath;
+    std::filesystem::path        mJournalPath;
+    size_t                       mCompactThreshold;
+    bool                         mSnapshotMapped;
+    std::atomic<UserCacheFormat> mFormat;
+    // Owned by the writer thread after start()
+    UserCacheFormat              mBaseFormat;
+    UserCacheTable               mMirror; // Complete for a json base, the overlay for a binary base
+    std::ofstream                mJournal;
+    size_t                       mJournalEntries = 0;
+    uintmax_t                    mJournalSize    = 0; // Size found by load()
+    uintmax_t                    mJournalValid   = 0; // End of the last complete line found by load()
+    // Shared with the callers of append()
+    std::mutex                   mMutex;
+    std::condition_variable      mCondition;
+    std::vector<UserCacheRecord> mPending;
+    bool                         mStopping = false;
+    std::thread                  mThread;
+
+public:
+    UserCacheJournal(
+        std::filesystem::path jsonPath,
+        std::filesystem::path binaryPath,
+        std::filesystem::path journalPath,
+        size_t                compactThreshold,
+        UserCacheFormat       format
+    );
+
+    ~UserCacheJournal();
+
+public:
+    // Loads the snapshot and replays the journal into table, must be called before start().
+    // A binary snapshot is not loaded, table only receives the journal.
+    void load(UserCacheTable& table);
+
+    void start();
+
+    // Never touches the disk, the record is written by the background thread.
+    void append(UserCacheRecord record);
+
+    // Writes all pending records, compacts and joins the background thread.
+    // A mapped binary snapshot must be closed before.
+    void stop();
+
+    // Applied by the next compaction.
+    void setFormat(UserCacheFormat format);
+
+    UserCacheFormat getFormat() const;
+
+private:
+    void run();
+
+    void writeRecords(std::vector<UserCacheRecord> const& records);
+
+    bool compact();
+
+    bool writeSnapshot(std::filesystem::path const& path, UserCacheFormat format, UserCacheImage const& base);
+};
+
+} // namespace GMLIB::Server::UserCache
@@ -0,0 +1,143 @@
+#include "Server/UserCache/UserCacheTable.h"
+
+namespace GMLIB::Server::UserCache {
+
+size_t UserCacheTable::find(std::unordered_map<std::string_view, size_t> const& index, std::string_view key) {
+    if (key.empty()) {
+        return npos;
+    }
+    auto it = index.find(key);
+    return it == index.end() ? npos : it->second;
+}
+
+void UserCacheTable::unlinkKey(
+    std::unordered_map<std::string_view, size_t>& index,
+    std::string_view                              key,
+    size_t                                        position
+) {
+    auto it = index.find(key);
+    if (it != index.end() && it->second == position) {
+        index.erase(it);
+    }
+}
+
+void UserCacheTable::linkKey(
+    std::unordered_map<std::string_view, size_t>& index,
+    std::string_view                              key,
+    size_t                                        position
+) {
+    // Empty keys (e.g. xuid on offline servers) are not indexed.
+    if (key.empty()) {
+        return;
+    }
+    // Erase first, the old key view may point into another record.
+    index.erase(key);
+    index.emplace(key, position);
+}
+
+void UserCacheTable::unlinkName(size_t position) {
+    auto& name = mRecords[position].mRealName;
+    auto  it   = mNameIndex.find(name);
+    if (it == mNameIndex.end()) {
+        return;
+    }
+    auto& holders = it->second;
+    std::erase(holders, position);
+    if (holders.empty()) {
+        mNameIndex.erase(it);
+        return;
+    }
+    // The key may be a view into this record's name, which is about to change.
+    if (it->first.data() == name.data()) {
+        auto node  = mNameIndex.extract(it);
+        node.key() = mRecords[node.mapped().back()].mRealName;
+        mNameIndex.insert(std::move(node));
+    }
+}
+
+void UserCacheTable::linkName(size_t position) {
+    auto& name = mRecords[position].mRealName;
+    if (name.empty()) {
+        return;
+    }
+    auto& holders = mNameIndex[name];
+    std::erase(holders, position);
+    holders.push_back(position);
+}
+
+bool UserCacheTable::update(std::string_view uuid, std::string_view xuid, std::string_view realName) {
+    auto position = find(mUuidIndex, uuid);
+    if (position == npos) {
+        auto& record = mRecords.emplace_back(std::string(uuid), std::string(xuid), std::string(realName));
+        position     = mRecords.size() - 1;
+        linkKey(mUuidIndex, record.mUuid, position);
+        linkKey(mXuidIndex, record.mXuid, position);
+        linkName(position);
+        return true;
+    }
+    auto& record = mRecords[position];
+    if (record.mXuid == xuid && record.mRealName == realName) {
+        // Still relink the name, it may have been taken over by another record.
+        linkName(position);
+        return false;
+    }
+    if (record.mXuid != xuid) {
+        unlinkKey(mXuidIndex, record.mXuid, position);
+        record.mXuid = xuid;
+    }
+    if (record.mRealName != realName) {
+        unlinkName(position);
+        record.mRealName = realName;
+    }
+    linkKey(mXuidIndex, record.mXuid, position);
+    linkName(position);
+    return true;
+}
+
+void UserCacheTable::clear() {
+    mUuidIndex.clear();
+    mXuidIndex.clear();
+    mNameIndex.clear();
+    mRecords.clear();
+}
+
+void UserCacheTable::reserve(size_t count) {
+    mUuidIndex.reserve(count);
+    mXuidIndex.reserve(count);
+    mNameIndex.reserve(count);
+}
+
+size_t UserCacheTable::size() const { return mRecords.size(); }
+
+size_t UserCacheTable::findByUuid(std::string_view uuid) const { return find(mUuidIndex, uuid); }
+
+size_t UserCacheTable::findByXuid(std::string_view xuid) const { return find(mXuidIndex, xuid); }
+
+size_t UserCacheTable::findByName(std::string_view name) const {
+    if (name.empty()) {
+        return npos;
+    }
+    auto it = mNameIndex.find(name);
+    return it == mNameIndex.end() ? npos : it->second.back();
+}
+
+UserCacheRecord const& UserCacheTable::at(size_t index) const { return mRecords.at(index); }
+
+UserCacheRecord const* UserCacheTable::tryGetByUuid(std::string_view uuid) const {
+    auto position = findByUuid(uuid);
+    return position == npos ? nullptr : &mRecords[position];
+}
+
+UserCacheRecord const* UserCacheTable::tryGetByXuid(std::string_view xuid) const {
+    auto position = findByXuid(xuid);
+    return position == npos ? nullptr : &mRecords[position];
+}
+
+UserCacheRecord const* UserCacheTable::tryGetByName(std::string_view name) const {
+    auto position = findByName(name);
+    return position == npos ? nullptr : &mRecords[position];
+}
+
+std::deque<UserCacheRecord> const& UserCacheTable::getRecords() const { return mRecords; }
+
+} // namespace GMLIB::Server::UserCache
@@ -0,0 +1,77 @@
+#pragma once
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Engine independent, strings are compared exactly as stored.
+namespace GMLIB::Server::UserCache {
+
+struct UserCacheRecord {
+    std::string mUuid;
+    std::string mXuid;
+    std::string mRealName;
+};
+
+// Record table with hash indexes on uuid, xuid and realName.
+// Records are never removed, so indexes store positions and the index keys are views into the records.
+// A name may be held by several records, the name index keeps all of them ordered by last update.
+class UserCacheTable {
+public:
+    static constexpr size_t npos = (size_t)-1;
+
+private:
+    std::deque<UserCacheRecord>                  mRecords;
+    std::unordered_map<std::string_view, size_t> mUuidIndex;
+    std::unordered_map<std::string_view, size_t> mXuidIndex;
+    std::unordered_map<std::string_view, std::vector<size_t>> mNameIndex;
+
+public:
+    UserCacheTable() = default;
+
+    UserCacheTable(UserCacheTable const&)            = delete;
+    UserCacheTable& operator=(UserCacheTable const&) = delete;
+
+public:
+    // Inserts a new record or updates the record with the same uuid.
+    // Returns false when nothing changed.
+    bool update(std::string_view uuid, std::string_view xuid, std::string_view realName);
+
+    void clear();
+
+    void reserve(size_t count);
+
+    size_t size() const;
+
+    size_t findByUuid(std::string_view uuid) const;
+
+    size_t findByXuid(std::string_view xuid) const;
+
+    // Several players may have used the same name, the last updated one wins.
+    size_t findByName(std::string_view name) const;
+
+    UserCacheRecord const& at(size_t index) const;
+
+    UserCacheRecord const* tryGetByUuid(std::string_view uuid) const;
+
+    UserCacheRecord const* tryGetByXuid(std::string_view xuid) const;
+
+    UserCacheRecord const* tryGetByName(std::string_view name) const;
+
+    std::deque<UserCacheRecord> const& getRecords() const;
+
+private:
+    static size_t find(std::unordered_map<std::string_view, size_t> const& index, std::string_view key);
+
+    void unlinkKey(std::unordered_map<std::string_view, size_t>& index, std::string_view key, size_t position);
+
+    void linkKey(std::unordered_map<std::string_view, size_t>& index, std::string_view key, size_t position);
+
+    void unlinkName(size_t position);
+
+    void linkName(size_t position);
+};
+
+} // namespace GMLIB::Server::UserCache
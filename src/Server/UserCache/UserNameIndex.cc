@@ -0,0 +1,209 @@
+#include "Server/UserCache/UserNameIndex.h"
+#include <algorithm>
+#include <tuple>
+
+namespace GMLIB::Server::UserCache {
+
+constexpr char TRIGRAM_PADDING = '\x01';
+
+std::string UserNameIndex::foldName(std::string_view name) {
+    std::string result(name);
+    for (auto& c : result) {
+        if (c >= 'A' && c <= 'Z') {
+            c = (char)(c - 'A' + 'a');
+        }
+    }
+    return result;
+}
+
+size_t UserNameIndex::getEditDistance(std::string_view left, std::string_view right, size_t maxDistance) {
+    auto lengthDiff = left.size() > right.size() ? left.size() - right.size() : right.size() - left.size();
+    if (lengthDiff > maxDistance) {
+        return maxDistance + 1;
+    }
+    std::vector<size_t> row(right.size() + 1);
+    for (size_t j = 0; j <= right.size(); j++) {
+        row[j] = j;
+    }
+    for (size_t i = 1; i <= left.size(); i++) {
+        size_t diagonal = row[0];
+        size_t rowMin   = row[0] = i;
+        for (size_t j = 1; j <= right.size(); j++) {
+            auto above = row[j];
+            row[j]     = std::min({row[j] + 1, row[j - 1] + 1, diagonal + (left[i - 1] == right[j - 1] ? 0 : 1)});
+            diagonal   = above;
+            rowMin     = std::min(rowMin, row[j]);
+        }
+        if (rowMin > maxDistance) {
+            return maxDistance + 1;
+        }
+    }
+    return std::min(row[right.size()], maxDistance + 1);
+}
+
+// Padded with two markers in front and one behind, so that even one and two letter names have trigrams.
+template <typename T>
+void UserNameIndex::forEachTrigram(std::string_view foldedName, bool padEnd, T&& callback) {
+    std::string padded;
+    padded.reserve(foldedName.size() + 3);
+    padded += TRIGRAM_PADDING;
+    padded += TRIGRAM_PADDING;
+    padded += foldedName;
+    if (padEnd) {
+        padded += TRIGRAM_PADDING;
+    }
+    for (size_t i = 0; i + 3 <= padded.size(); i++) {
+        callback((uint32_t)(uint8_t)padded[i] << 16 | (uint32_t)(uint8_t)padded[i + 1] << 8 | (uint8_t)padded[i + 2]);
+    }
+}
+
+void UserNameIndex::link(uint32_t id) {
+    auto& entry = mEntries[id];
+    mSortedNames.emplace(entry.mFoldedName, id);
+    forEachTrigram(entry.mFoldedName, true, [&](uint32_t trigram) {
+        // Posting lists stay sorted, new players are appended.
+        auto& postings = mTrigrams[trigram];
+        auto  position = std::lower_bound(postings.begin(), postings.end(), id);
+        if (position == postings.end() || *position != id) {
+            postings.insert(position, id);
+        }
+    });
+}
+
+void UserNameIndex::unlink(uint32_t id) {
+    auto& entry = mEntries[id];
+    mSortedNames.erase({entry.mFoldedName, id});
+    forEachTrigram(entry.mFoldedName, true, [&](uint32_t trigram) {
+        auto it = mTrigrams.find(trigram);
+        if (it == mTrigrams.end()) {
+            return;
+        }
+        auto& postings = it->second;
+        auto  position = std::lower_bound(postings.begin(), postings.end(), id);
+        if (position != postings.end() && *position == id) {
+            postings.erase(position);
+        }
+        if (postings.empty()) {
+            mTrigrams.erase(it);
+        }
+    });
+}
+
+void UserNameIndex::update(std::string_view uuid, std::string_view name) {
+    auto folded = foldName(name);
+    auto it     = mUuidIndex.find(uuid);
+    if (it != mUuidIndex.end()) {
+        auto id = it->second;
+        if (mEntries[id].mFoldedName == folded) {
+            return;
+        }
+        unlink(id);
+        mEntries[id].mFoldedName = std::move(folded);
+        link(id);
+        return;
+    }
+    auto  id    = (uint32_t)mEntries.size();
+    auto& entry = mEntries.emplace_back(std::string(uuid), std::move(folded));
+    mUuidIndex.emplace(entry.mUuid, id);
+    link(id);
+}
+
+void UserNameIndex::clear() {
+    mTrigrams.clear();
+    mSortedNames.clear();
+    mUuidIndex.clear();
+    mEntries.clear();
+}
+
+size_t UserNameIndex::size() const { return mEntries.size(); }
+
+std::vector<std::string> UserNameIndex::findByPrefix(std::string_view prefix, size_t limit) const {
+    std::vector<std::string> result;
+    auto                     folded = foldName(prefix);
+    for (auto it = mSortedNames.lower_bound({folded, 0}); it != mSortedNames.end() && result.size() < limit; it++) {
+        if (!it->first.starts_with(folded)) {
+            break;
+        }
+        result.push_back(mEntries[it->second].mUuid);
+    }
+    return result;
+}
+
+std::vector<std::string> UserNameIndex::findSimilar(std::string_view name, size_t limit, size_t maxDistance) const {
+    std::vector<std::string> result;
+    auto                     folded = foldName(name);
+    if (folded.empty() || limit == 0) {
+        return result;
+    }
+    // One typo per four letters, more would match most of the short names.
+    maxDistance = std::min(maxDistance, folded.size() / 4);
+    // The trailing trigram is left out, so that longer names starting with the query still share every trigram.
+    std::vector<std::vector<uint32_t> const*> postings;
+    size_t                                    queryTrigrams = 0;
+    forEachTrigram(folded, false, [&](uint32_t trigram) {
+        queryTrigrams++;
+        if (auto it = mTrigrams.find(trigram); it != mTrigrams.end()) {
+            postings.push_back(&it->second);
+        }
+    });
+    // Every edit destroys at most three trigrams, so a match shares at least minHits of them,
+    // and must be in one of the (queryTrigrams - minHits + 1) shortest posting lists.
+    size_t minHits = queryTrigrams > maxDistance * 3 ? queryTrigrams - maxDistance * 3 : 1;
+    if (postings.size() < minHits) {
+        return result;
+    }
+    std::sort(postings.begin(), postings.end(), [](auto left, auto right) { return left->size() < right->size(); });
+    // Candidates are counted over the short lists, the long lists are only probed by binary search.
+    // The counters are kept per thread and only the touched ones are reset, so a query does not cost
+    // the number of names.
+    thread_local std::vector<uint16_t> hits;
+    if (hits.size() < mEntries.size()) {
+        hits.resize(mEntries.size(), 0);
+    }
+    auto                  shortLists = std::min(postings.size(), queryTrigrams - minHits + 1);
+    std::vector<uint32_t> touched;
+    for (size_t i = 0; i < shortLists; i++) {
+        for (auto id : *postings[i]) {
+            if (hits[id]++ == 0) {
+                touched.push_back(id);
+            }
+        }
+    }
+    // (distance, not a prefix, length difference, id)
+    std::vector<std::tuple<size_t, bool, size_t, uint32_t>> candidates;
+    for (auto id : touched) {
+        size_t count = hits[id];
+        hits[id]     = 0;
+        for (size_t i = shortLists; i < postings.size() && count < minHits; i++) {
+            if (count + (postings.size() - i) < minHits) {
+                break;
+            }
+            if (std::binary_search(postings[i]->begin(), postings[i]->end(), id)) {
+                count++;
+            }
+        }
+        if (count < minHits) {
+            continue;
+        }
+        std::string_view candidate = mEntries[id].mFoldedName;
+        auto             distance  = getEditDistance(folded, candidate, maxDistance);
+        bool             isPrefix  = candidate.starts_with(folded);
+        if (candidate.size() > folded.size()) {
+            auto head = candidate.substr(0, folded.size());
+            distance  = std::min(distance, getEditDistance(folded, head, maxDistance));
+        }
+        if (distance > maxDistance) {
+            continue;
+        }
+        auto lengthDiff = candidate.size() > folded.size() ? candidate.size() - folded.size() : 0;
+        candidates.emplace_back(isPrefix ? 0 : distance, !isPrefix, lengthDiff, id);
+    }
+    auto count = std::min(limit, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end());
+    for (size_t i = 0; i < count; i++) {
+        result.push_back(mEntries[std::get<3>(candidates[i])].mUuid);
+    }
+    return result;
+}
+
+} // namespace GMLIB::Server::UserCache
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Engine independent. Names are case folded in ASCII, which covers Xbox gamertags.
+namespace GMLIB::Server::UserCache {
+
+// Name search over every cached player: a sorted set of folded names for prefix lookups,
+// and a trigram index whose candidates are ranked by edit distance for typo tolerant lookups.
+class UserNameIndex {
+private:
+    struct Entry {
+        std::string mUuid;
+        std::string mFoldedName;
+    };
+
+    std::deque<Entry>                                   mEntries;
+    std::unordered_map<std::string_view, uint32_t>      mUuidIndex;
+    std::set<std::pair<std::string_view, uint32_t>>     mSortedNames;
+    std::unordered_map<uint32_t, std::vector<uint32_t>> mTrigrams;
+
+public:
+    UserNameIndex() = default;
+
+    UserNameIndex(UserNameIndex const&)            = delete;
+    UserNameIndex& operator=(UserNameIndex const&) = delete;
+
+public:
+    // Adds the player, or moves the player to its new name.
+    void update(std::string_view uuid, std::string_view name);
+
+    void clear();
+
+    size_t size() const;
+
+    // Returns uuids, ordered by name.
+    std::vector<std::string> findByPrefix(std::string_view prefix, size_t limit) const;
+
+    // Returns uuids, exact and prefix matches first, then by edit distance to the name or its prefix.
+    std::vector<std::string> findSimilar(std::string_view name, size_t limit, size_t maxDistance) const;
+
+public:
+    static std::string foldName(std::string_view name);
+
+    // Bounded Levenshtein distance, returns maxDistance + 1 when exceeded.
+    static size_t getEditDistance(std::string_view left, std::string_view right, size_t maxDistance);
+
+private:
+    template <typename T>
+    static void forEachTrigram(std::string_view foldedName, bool padEnd, T&& callback);
+
+    void link(uint32_t id);
+
+    void unlink(uint32_t id);
+};
+
+} // namespace GMLIB::Server::UserCache
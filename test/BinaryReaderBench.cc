@@ -0,0 +1,77 @@
+#include "GMLIB/Server/BinaryReader.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+using GMLIB::Server::BinaryReader;
+
+// The encoding of GMLIB_BinaryStream, which needs the engine.
+void writeUnsignedVarInt64(std::string& buffer, uint64_t value) {
+    while (value >= 0x80) {
+        buffer.push_back((char)(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back((char)value);
+}
+
+void writeVarInt(std::string& buffer, int32_t value) {
+    writeUnsignedVarInt64(buffer, (uint32_t)(((uint32_t)value << 1) ^ (uint32_t)(value >> 31)));
+}
+
+void writeString(std::string& buffer, std::string_view value) {
+    writeUnsignedVarInt64(buffer, value.size());
+    buffer.append(value);
+}
+
+double getMilliseconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Usage: BinaryReaderBench [record count], each record is a varint, a zigzag varint, a string and a float, the mix
+// of an entity or score packet.
+int main(int argc, char** argv) {
+    uint64_t        recordCount = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+    std::mt19937_64 random(1);
+    std::string     data;
+    for (uint64_t i = 0; i < recordCount; i++) {
+        writeUnsignedVarInt64(data, random() >> (random() % 64));
+        writeVarInt(data, (int32_t)random() >> (random() % 32));
+        writeString(data, std::string(random() % 24, 'a'));
+        float value = (float)i;
+        data.append((char const*)&value, sizeof(value));
+    }
+
+    auto         start = std::chrono::steady_clock::now();
+    BinaryReader reader(data);
+    uint64_t     checksum = 0;
+    for (uint64_t i = 0; i < recordCount; i++) {
+        auto id     = reader.readUnsignedVarInt64();
+        auto score  = reader.readVarInt();
+        auto name   = reader.readString();
+        auto health = reader.readFloat();
+        if (!id || !score || !name || !health) {
+            std::printf("Failed to read record %llu\n", (unsigned long long)i);
+            return 1;
+        }
+        checksum += *id + (uint64_t)*score + name->size() + (uint64_t)*health;
+    }
+    auto time = getMilliseconds(start);
+    if (!reader.isEnd()) {
+        return 1;
+    }
+    std::printf(
+        "%llu records, %zu bytes, checksum %llx\n",
+        (unsigned long long)recordCount,
+        data.size(),
+        (unsigned long long)checksum
+    );
+    std::printf(
+        "read: %.1f ms, %.1f M records/s, %.0f MB/s\n",
+        time,
+        (double)recordCount / time / 1000,
+        (double)data.size() / time / 1000
+    );
+    return 0;
+}
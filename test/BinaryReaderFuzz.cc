@@ -0,0 +1,118 @@
+#include "GMLIB/Server/BinaryReader.h"
+#include <cstdio>
+#include <cstdlib>
+
+// libFuzzer target. Each input byte picks the next read, the rest of the input is what is read from. Checks that a
+// failed read keeps the position, and that a successful one stays in the buffer and decodes what it consumed.
+
+using GMLIB::Server::BinaryReader;
+
+#define FUZZ_CHECK(condition)                                                                                          \
+    if (!(condition)) {                                                                                                \
+        std::fprintf(stderr, "%s:%d: FUZZ_CHECK(%s) failed\n", __FILE__, __LINE__, #condition);                        \
+        std::abort();                                                                                                  \
+    }
+
+// What readVarIntBits accepts, written without the shortcuts of the reader.
+std::optional<uint64_t> decodeVarInt(std::string_view data, size_t maxBytes, size_t& size) {
+    uint64_t value = 0;
+    for (size = 0; size < maxBytes && size < data.size(); size++) {
+        auto byte = (uint8_t)data[size];
+        if (size == 9 && byte > 0x01) {
+            return {};
+        }
+        value |= (uint64_t)(byte & 0x7f) << (7 * size);
+        if (!(byte & 0x80)) {
+            size++;
+            return value;
+        }
+    }
+    return {};
+}
+
+template <typename T>
+void checkRead(BinaryReader& reader, std::optional<T> const& result, size_t start) {
+    if (!result) {
+        FUZZ_CHECK(reader.getPosition() == start);
+    } else {
+        FUZZ_CHECK(reader.getPosition() >= start && reader.getPosition() <= reader.getData().size());
+    }
+}
+
+void checkVarInt(
+    BinaryReader&           reader,
+    size_t                  start,
+    size_t                  maxBytes,
+    uint64_t                maxValue,
+    std::optional<uint64_t> value
+) {
+    size_t size;
+    auto   expected = decodeVarInt(reader.getData().substr(start), maxBytes, size);
+    if (expected && *expected > maxValue) {
+        expected.reset();
+    }
+    FUZZ_CHECK(value.has_value() == expected.has_value());
+    if (value) {
+        FUZZ_CHECK(*value == *expected && reader.getPosition() == start + size);
+    } else {
+        FUZZ_CHECK(reader.getPosition() == start);
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(uint8_t const* data, size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+    std::string_view ops((char const*)data, size / 4 + 1);
+    BinaryReader     reader(std::string_view((char const*)data, size).substr(ops.size()));
+    for (auto op : ops) {
+        auto start = reader.getPosition();
+        switch ((uint8_t)op % 10) {
+        case 0: {
+            auto value = reader.readUnsignedVarInt();
+            checkVarInt(reader, start, 5, UINT32_MAX, value ? std::optional<uint64_t>(*value) : std::nullopt);
+            break;
+        }
+        case 1:
+            checkVarInt(reader, start, 10, UINT64_MAX, reader.readUnsignedVarInt64());
+            break;
+        case 2:
+            checkRead(reader, reader.readVarInt(), start);
+            break;
+        case 3:
+            checkRead(reader, reader.readVarInt64(), start);
+            break;
+        case 4: {
+            auto value = reader.readString();
+            checkRead(reader, value, start);
+            if (value) {
+                FUZZ_CHECK(value->data() + value->size() == reader.getData().data() + reader.getPosition());
+            }
+            break;
+        }
+        case 5: {
+            auto value = reader.readNbt();
+            checkRead(reader, value, start);
+            if (value) {
+                // The tag read on its own ends where it ended in the buffer.
+                BinaryReader tag(*value);
+                FUZZ_CHECK(tag.readNbt() && tag.isEnd());
+            }
+            break;
+        }
+        case 6:
+            checkRead(reader, reader.readUnsignedShort(), start);
+            break;
+        case 7:
+            checkRead(reader, reader.readDouble(), start);
+            break;
+        case 8:
+            checkRead(reader, reader.readSignedBigEndianInt(), start);
+            break;
+        case 9:
+            checkRead(reader, reader.readBytes((uint8_t)op / 10), start);
+            break;
+        }
+    }
+    return 0;
+}
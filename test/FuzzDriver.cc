@@ -0,0 +1,41 @@
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+// Runs a libFuzzer target without libFuzzer, for compilers that do not have it. With file arguments each file is
+// run once, otherwise random inputs are generated: FuzzDriver [iterations] [seed].
+
+extern "C" int LLVMFuzzerTestOneInput(uint8_t const* data, size_t size);
+
+// Bytes that end or continue varints, and NBT tag types.
+constexpr uint8_t INTERESTING_BYTES[] = {0x00, 0x01, 0x02, 0x03, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x7f, 0x80, 0xff};
+
+int main(int argc, char** argv) {
+    if (argc > 1 && !std::isdigit((unsigned char)argv[1][0])) {
+        for (int i = 1; i < argc; i++) {
+            std::ifstream        file(argv[i], std::ios::binary);
+            std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+            LLVMFuzzerTestOneInput(data.data(), data.size());
+        }
+        return 0;
+    }
+    uint64_t             iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    std::mt19937_64      random(argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1);
+    std::vector<uint8_t> data;
+    for (uint64_t i = 0; i < iterations; i++) {
+        data.resize(random() % 257);
+        for (auto& byte : data) {
+            auto choice = random();
+            auto value  = (uint8_t)(choice >> 8);
+            byte        = choice % 4 ? INTERESTING_BYTES[value % sizeof(INTERESTING_BYTES)] : value;
+        }
+        LLVMFuzzerTestOneInput(data.data(), data.size());
+    }
+    std::printf("%llu inputs passed\n", (unsigned long long)iterations);
+    return 0;
+}
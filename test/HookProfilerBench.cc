@@ -0,0 +1,73 @@
+#include "Server/HookProfiler/HookProfiler.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+// Cost a profiled hook adds to each call: disabled, enabled, and enabled with threads recording into one site.
+
+// Stands in for the original function, kept out of line so that it is really called.
+[[gnu::noinline]] int origin(int value) { return value * 3 + 1; }
+
+[[gnu::noinline]] int unprofiledHook(int value) { return origin(value) + 1; }
+
+[[gnu::noinline]] int profiledHook(int value) {
+    GMLIB_PROFILE_HOOK(ProfiledHook);
+    auto result = GMLIB_PROFILE_ORIGIN(origin(value));
+    return result + 1;
+}
+
+int readClock(int) { return (int)std::chrono::steady_clock::now().time_since_epoch().count(); }
+
+volatile int mSink;
+
+template <typename Fn>
+double getNanosecondsPerCall(uint64_t calls, Fn&& fn) {
+    auto start    = std::chrono::steady_clock::now();
+    int  checksum = 0;
+    for (uint64_t i = 0; i < calls; i++) {
+        checksum += fn((int)i);
+    }
+    auto time = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    mSink     = checksum;
+    return time / (double)calls;
+}
+
+// Usage: HookProfilerBench [calls]
+int main(int argc, char** argv) {
+    uint64_t calls = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+    // An enabled hook reads the clock four times.
+    auto clock    = getNanosecondsPerCall(calls, readClock);
+    auto baseline = getNanosecondsPerCall(calls, unprofiledHook);
+    auto disabled = getNanosecondsPerCall(calls, profiledHook);
+
+    GMLIB::HookProfilerAPI::mEnabled = true;
+
+    auto enabled = getNanosecondsPerCall(calls, profiledHook);
+
+    auto                     threadCount = std::max(2u, std::min(8u, std::thread::hardware_concurrency()));
+    std::vector<double>      threadTimes(threadCount);
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < threadCount; i++) {
+        threads.emplace_back([&, i] { threadTimes[i] = getNanosecondsPerCall(calls / threadCount, profiledHook); });
+    }
+    double contended = 0;
+    for (unsigned i = 0; i < threadCount; i++) {
+        threads[i].join();
+        contended = std::max(contended, threadTimes[i]);
+    }
+
+    auto site = GMLIB::HookProfilerAPI::findSite("ProfiledHook");
+    if (!site || site->mCalls != calls + calls / threadCount * threadCount) {
+        std::printf("Calls were not all recorded\n");
+        return 1;
+    }
+    std::printf("steady_clock::now:  %.1f ns/call\n", clock);
+    std::printf("unprofiled:         %.1f ns/call\n", baseline);
+    std::printf("profiling disabled: %.1f ns/call (+%.1f)\n", disabled, disabled - baseline);
+    std::printf("profiling enabled:  %.1f ns/call (+%.1f)\n", enabled, enabled - baseline);
+    std::printf("enabled, %u threads: %.1f ns/call (+%.1f)\n", threadCount, contended, contended - baseline);
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include "Server/PlayerAPI/KeyedTaskQueue.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace GMLIB::PlayerAPI;
+
+// Tasks per second through the queue, with every task on its own player and with all of them writing one player.
+
+std::atomic<uint64_t> mSink;
+
+// Stands in for encoding and saving a player tag.
+class WriteTask : public KeyedTask {
+public:
+    std::string mData;
+    int         mCallbacks = 1;
+
+public:
+    explicit WriteTask(size_t size) : mData(size, 'x') {}
+
+    void run() override {
+        uint64_t hash = 14695981039346656037ull;
+        for (auto c : mData) {
+            hash = (hash ^ (uint8_t)c) * 1099511628211ull;
+        }
+        mSink += hash;
+    }
+
+    bool merge(KeyedTask& next) override {
+        auto write = dynamic_cast<WriteTask*>(&next);
+        if (!write) {
+            return false;
+        }
+        mData.swap(write->mData);
+        mCallbacks += write->mCallbacks;
+        return true;
+    }
+};
+
+double getTasksPerSecond(uint32_t workerCount, size_t taskCount, size_t taskSize, size_t keyCount) {
+    KeyedTaskQueue           queue;
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < keyCount; i++) {
+        keys.push_back("player_server_" + std::to_string(i));
+    }
+    queue.start(workerCount);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < taskCount; i++) {
+        queue.submit(keys[i % keyCount], std::make_shared<WriteTask>(taskSize));
+        if (i % 64 == 0) {
+            queue.drainCompletions();
+        }
+    }
+    queue.stop();
+    queue.drainCompletions();
+    auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return (double)taskCount / seconds;
+}
+
+// Usage: KeyedTaskQueueBench [task count] [task bytes]
+int main(int argc, char** argv) {
+    size_t taskCount = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    size_t taskSize  = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 4096;
+
+    std::printf("%zu tasks of %zu bytes\n", taskCount, taskSize);
+    for (uint32_t workers : {1u, 2u, 4u}) {
+        auto distinct = getTasksPerSecond(workers, taskCount, taskSize, 10000);
+        auto merged   = getTasksPerSecond(workers, taskCount, taskSize, 1);
+        std::printf("  %u workers: %8.0f tasks/s on 10000 players, %8.0f on one player\n", workers, distinct, merged);
+    }
+    return 0;
+}
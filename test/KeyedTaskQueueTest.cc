@@ -0,0 +1,244 @@
+#include "Server/PlayerAPI/KeyedTaskQueue.h"
+#include "TestCheck.h"
+#include <atomic>
+#include <functional>
+#include <optional>
+#include <random>
+
+using namespace GMLIB::PlayerAPI;
+
+// Loads and writes of an in-memory store, merged the way AsyncNbt merges them.
+
+std::mutex                           mStoreMutex;
+std::unordered_map<std::string, int> mStore;
+std::atomic<int>                     mWriteRuns;
+// Set while a task of the key runs, a second task running at the same time is counted in mOverlaps.
+std::unordered_map<std::string, std::atomic<bool>> mRunningKeys;
+std::atomic<int>                                   mOverlaps;
+
+class StoreTask : public KeyedTask {
+public:
+    std::string mKey;
+
+public:
+    explicit StoreTask(std::string key) : mKey(std::move(key)) {}
+
+    void run() override {
+        auto& running = mRunningKeys.at(mKey);
+        if (running.exchange(true)) {
+            mOverlaps++;
+        }
+        access();
+        running = false;
+    }
+
+    virtual void access() = 0;
+};
+
+class WriteTask : public StoreTask {
+public:
+    int                                    mValue;
+    std::vector<std::function<void(bool)>> mCallbacks;
+
+public:
+    WriteTask(std::string key, int value, std::function<void(bool)> callback)
+    : StoreTask(std::move(key)),
+      mValue(value),
+      mCallbacks{std::move(callback)} {}
+
+    void access() override {
+        std::lock_guard lock(mStoreMutex);
+        mStore[mKey] = mValue;
+        mWriteRuns++;
+    }
+
+    void complete() override {
+        for (auto& callback : mCallbacks) {
+            callback(true);
+        }
+    }
+
+    bool merge(KeyedTask& next) override {
+        auto write = dynamic_cast<WriteTask*>(&next);
+        if (!write) {
+            return false;
+        }
+        mValue = write->mValue;
+        mCallbacks.insert(mCallbacks.end(), write->mCallbacks.begin(), write->mCallbacks.end());
+        return true;
+    }
+};
+
+class LoadTask : public StoreTask {
+public:
+    std::optional<int>                                   mValue;
+    std::vector<std::function<void(std::optional<int>)>> mCallbacks;
+
+public:
+    LoadTask(std::string key, std::function<void(std::optional<int>)> callback)
+    : StoreTask(std::move(key)),
+      mCallbacks{std::move(callback)} {}
+
+    void access() override {
+        std::lock_guard lock(mStoreMutex);
+        auto            iter = mStore.find(mKey);
+        if (iter != mStore.end()) {
+            mValue = iter->second;
+        }
+    }
+
+    void complete() override {
+        for (auto& callback : mCallbacks) {
+            callback(mValue);
+        }
+    }
+
+    bool merge(KeyedTask& next) override {
+        auto load = dynamic_cast<LoadTask*>(&next);
+        if (!load) {
+            return false;
+        }
+        mCallbacks.insert(mCallbacks.end(), load->mCallbacks.begin(), load->mCallbacks.end());
+        return true;
+    }
+};
+
+// Holds its key until opened.
+class GateTask : public KeyedTask {
+public:
+    std::atomic<bool> mStarted = false;
+    std::atomic<bool> mOpen    = false;
+
+public:
+    void run() override {
+        mStarted = true;
+        while (!mOpen) {
+            std::this_thread::yield();
+        }
+    }
+};
+
+void resetStore(std::vector<std::string> const& keys) {
+    mStore.clear();
+    mWriteRuns = 0;
+    mRunningKeys.clear();
+    for (auto& key : keys) {
+        mRunningKeys[key] = false;
+    }
+}
+
+void checkSupersede() {
+    resetStore({"a", "b"});
+    KeyedTaskQueue queue;
+    queue.start(2);
+    auto gate = std::make_shared<GateTask>();
+    queue.submit("a", gate);
+    while (!gate->mStarted) {
+        std::this_thread::yield();
+    }
+    // Writes queued behind the running task collapse into the first one, with every callback kept.
+    std::vector<bool> results;
+    for (int i = 1; i <= 3; i++) {
+        queue.submit("a", std::make_shared<WriteTask>("a", i, [&](bool result) { results.push_back(result); }));
+    }
+    CHECK(queue.getMergedCount() == 2);
+    // A load in between keeps the writes on either side of it apart.
+    std::optional<int> loaded;
+    queue.submit("a", std::make_shared<LoadTask>("a", [&](std::optional<int> value) { loaded = value; }));
+    queue.submit("a", std::make_shared<WriteTask>("a", 4, [&](bool result) { results.push_back(result); }));
+    CHECK(queue.getMergedCount() == 2);
+    CHECK(queue.getQueuedCount() == 4);
+    gate->mOpen = true;
+    queue.stop();
+    CHECK(mWriteRuns == 2);
+    CHECK(mStore["a"] == 4);
+    CHECK(loaded == std::nullopt && results.empty());
+    CHECK(queue.drainCompletions() == 4);
+    CHECK(loaded == 3);
+    CHECK((results == std::vector<bool>{true, true, true, true}));
+}
+
+// Random writes and loads over a few keys, each load sees the last write submitted before it.
+void checkLoadAfterWrite() {
+    constexpr int            KEY_COUNT = 50;
+    std::vector<std::string> keys;
+    for (int i = 0; i < KEY_COUNT; i++) {
+        keys.push_back("player_server_" + std::to_string(i));
+    }
+    resetStore(keys);
+    KeyedTaskQueue queue;
+    queue.start(4);
+    std::vector<std::optional<int>> written(KEY_COUNT);
+    std::mt19937                    random(12);
+    int                             completed  = 0;
+    int                             mismatches = 0;
+    for (int i = 0; i < 20000; i++) {
+        auto  index = random() % KEY_COUNT;
+        auto& key   = keys[index];
+        if (random() % 2) {
+            queue.submit(key, std::make_shared<WriteTask>(key, i, [&](bool) { completed++; }));
+            written[index] = i;
+        } else {
+            queue.submit(key, std::make_shared<LoadTask>(key, [&, expected = written[index]](std::optional<int> value) {
+                mismatches += value != expected;
+                completed++;
+            }));
+        }
+        if (i % 100 == 0) {
+            queue.drainCompletions();
+        }
+    }
+    queue.stop();
+    queue.drainCompletions();
+    CHECK(mismatches == 0);
+    CHECK(completed == 20000);
+    CHECK(mOverlaps == 0);
+    CHECK(queue.getQueuedCount() == 0);
+    for (int i = 0; i < KEY_COUNT; i++) {
+        CHECK(mStore.contains(keys[i]) == written[i].has_value());
+        CHECK(!written[i] || mStore[keys[i]] == *written[i]);
+    }
+}
+
+void checkCompletions() {
+    resetStore({"a", "b"});
+    KeyedTaskQueue queue;
+    // Without workers the task runs and completes on the calling thread.
+    int completed = 0;
+    queue.submit("a", std::make_shared<WriteTask>("a", 1, [&](bool) { completed++; }));
+    CHECK(completed == 1 && mStore["a"] == 1);
+
+    queue.start(2);
+    std::vector<std::thread::id> threads;
+    for (int i = 0; i < 100; i++) {
+        auto key = i % 2 ? "a" : "b";
+        queue.submit(key, std::make_shared<LoadTask>(key, [&](std::optional<int>) {
+            threads.push_back(std::this_thread::get_id());
+        }));
+    }
+    while (queue.getQueuedCount()) {
+        std::this_thread::yield();
+    }
+    // Finished tasks wait for drainCompletions, which completes them on its thread.
+    CHECK(threads.empty());
+    size_t drained = 0;
+    while (drained + queue.getMergedCount() < 100) {
+        drained += queue.drainCompletions();
+    }
+    CHECK(threads.size() == 100);
+    for (auto id : threads) {
+        CHECK(id == std::this_thread::get_id());
+    }
+    CHECK(queue.drainCompletions() == 0);
+
+    queue.stop();
+    queue.submit("b", std::make_shared<WriteTask>("b", 2, [&](bool) { completed++; }));
+    CHECK(completed == 2 && mStore["b"] == 2);
+}
+
+int main() {
+    checkSupersede();
+    checkLoadAfterWrite();
+    checkCompletions();
+    return finishTest();
+}
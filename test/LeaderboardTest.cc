@@ -0,0 +1,152 @@
+#include "Server/ScoreboardAPI/Leaderboard.h"
+#include "TestCheck.h"
+#include <climits>
+#include <map>
+#include <random>
+
+using namespace GMLIB::ScoreboardAPI;
+
+// The leaderboard against a map of scores sorted on every query.
+struct Reference {
+    std::map<int64_t, int> mScores;
+    bool                   mDescending;
+
+    std::vector<Leaderboard::Entry> getSorted() const {
+        std::vector<Leaderboard::Entry> entries;
+        for (auto& [id, score] : mScores) {
+            entries.push_back({id, score});
+        }
+        std::sort(entries.begin(), entries.end(), [this](auto const& left, auto const& right) {
+            if (left.mScore != right.mScore) {
+                return mDescending ? left.mScore > right.mScore : left.mScore < right.mScore;
+            }
+            return left.mId < right.mId;
+        });
+        return entries;
+    }
+};
+
+namespace GMLIB::ScoreboardAPI {
+
+bool operator==(Leaderboard::Entry const& left, Leaderboard::Entry const& right) {
+    return left.mId == right.mId && left.mScore == right.mScore;
+}
+
+} // namespace GMLIB::ScoreboardAPI
+
+std::vector<Leaderboard::Entry> slice(std::vector<Leaderboard::Entry> const& entries, size_t offset, size_t count) {
+    if (offset >= entries.size()) {
+        return {};
+    }
+    auto end = entries.begin() + (ptrdiff_t)std::min(entries.size(), offset + count);
+    return {entries.begin() + (ptrdiff_t)offset, end};
+}
+
+void checkTies(bool descending) {
+    Leaderboard board(descending);
+    CHECK(board.set(30, 5) && board.set(10, 5) && board.set(20, 5) && board.set(40, 7));
+    CHECK(!board.set(10, 5));
+    // Equal scores are ordered by id in both orders.
+    auto top = board.getTop(4);
+    CHECK(top.size() == 4);
+    std::vector<int64_t> expected{10, 20, 30, 40};
+    if (descending) {
+        expected = {40, 10, 20, 30};
+    }
+    for (size_t i = 0; i < top.size(); i++) {
+        CHECK(top[i].mId == expected[i]);
+        CHECK(board.getRank(expected[i]) == i);
+    }
+    // Updating the same id moves it.
+    CHECK(!board.set(30, descending ? 8 : 1));
+    CHECK(board.getRank(30) == 0u && board.size() == 4);
+    CHECK(board.getScore(30) == (descending ? 8 : 1));
+    // Removing and adding again places it by its new score.
+    CHECK(board.remove(10) && !board.remove(10) && !board.getRank(10) && !board.getScore(10));
+    CHECK(board.set(10, 5));
+    CHECK(board.getRank(10) == (descending ? 2u : 1u));
+    CHECK(board.getScoreRange(5, 5).size() == 2);
+    CHECK(board.getScoreRange(6, 4).empty());
+}
+
+void checkExtremes(bool descending) {
+    Leaderboard board(descending);
+    board.set(1, INT_MIN);
+    board.set(2, INT_MAX);
+    board.set(3, 0);
+    auto all = board.getScoreRange(INT_MIN, INT_MAX);
+    CHECK(all.size() == 3);
+    CHECK(all.front().mId == (descending ? 2 : 1) && all.back().mId == (descending ? 1 : 2));
+    CHECK(board.getScoreRange(INT_MIN, INT_MIN).size() == 1);
+    CHECK(board.getRange(3, 10).empty() && board.getRange(0, 0).empty());
+    board.clear();
+    CHECK(board.size() == 0 && board.getTop(10).empty() && !board.getRank(1));
+    CHECK(board.set(1, 1) && board.getRank(1) == 0u);
+}
+
+// Random sets, updates, removes and clears, every query compared against the reference.
+void checkRandom(bool descending, unsigned seed) {
+    Leaderboard  board(descending);
+    Reference    reference{{}, descending};
+    std::mt19937 random(seed);
+    int          mismatches = 0;
+    for (int i = 0; i < 20000; i++) {
+        // Few ids and a narrow score range, so that ties, updates and re-adds are common.
+        auto id    = (int64_t)(random() % 300) - 100;
+        auto score = (int)(random() % 50) - 25;
+        switch (random() % 10) {
+        case 0:
+        case 1:
+        case 2:
+            mismatches += board.remove(id) != (reference.mScores.erase(id) == 1);
+            break;
+        case 3:
+            if (random() % 50 == 0) {
+                board.clear();
+                reference.mScores.clear();
+            }
+            break;
+        default:
+            mismatches += board.set(id, score) != !reference.mScores.contains(id);
+            reference.mScores[id] = score;
+            break;
+        }
+        if (i % 10) {
+            continue;
+        }
+        auto sorted  = reference.getSorted();
+        mismatches  += board.size() != sorted.size();
+        for (size_t rank = 0; rank < sorted.size(); rank += 1 + random() % 8) {
+            mismatches += board.getRank(sorted[rank].mId) != rank;
+            mismatches += board.getScore(sorted[rank].mId) != sorted[rank].mScore;
+        }
+        mismatches += board.getRank(1000).has_value();
+        auto offset  = random() % (sorted.size() + 5);
+        auto count   = random() % 20;
+        mismatches  += board.getRange(offset, count) != slice(sorted, offset, count);
+        mismatches  += board.getTop(count) != slice(sorted, 0, count);
+
+        auto                            minScore = (int)(random() % 60) - 30;
+        auto                            maxScore = minScore + (int)(random() % 20);
+        auto                            limit    = random() % 4 ? SIZE_MAX : random() % 10;
+        std::vector<Leaderboard::Entry> inRange;
+        for (auto& entry : sorted) {
+            if (entry.mScore >= minScore && entry.mScore <= maxScore && inRange.size() < limit) {
+                inRange.push_back(entry);
+            }
+        }
+        mismatches += board.getScoreRange(minScore, maxScore, limit) != inRange;
+    }
+    CHECK(mismatches == 0);
+}
+
+int main() {
+    for (bool descending : {true, false}) {
+        checkTies(descending);
+        checkExtremes(descending);
+        for (unsigned seed = 1; seed <= 5; seed++) {
+            checkRandom(descending, seed);
+        }
+    }
+    return finishTest();
+}
@@ -0,0 +1,127 @@
+#include "NbtTree.h"
+#include "Server/PlayerAPI/NbtPatcher.h"
+#include "TestCheck.h"
+#include <random>
+
+using namespace GMLIB::PlayerAPI;
+
+// What setPlayerNbtTags did before patching: decode everything, replace the fields, encode everything.
+std::optional<NbtTree> patchTree(std::string_view data, std::string_view replacement) {
+    auto tree   = NbtTree::decode(data);
+    auto fields = NbtTree::decode(replacement);
+    if (!tree || !fields) {
+        return std::nullopt;
+    }
+    for (auto& [name, field] : fields->mCompound) {
+        tree->mCompound[name] = field;
+    }
+    return NbtTree::decode(tree->encode());
+}
+
+// The patched blob scans, and holds the same tree as the decode, modify and encode round trip.
+void checkPatch(std::string_view data, std::string_view replacement) {
+    auto patched  = NbtPatcher::patch(data, replacement);
+    auto expected = patchTree(data, replacement);
+    CHECK(patched && expected);
+    if (!patched || !expected) {
+        return;
+    }
+    CHECK(NbtScanner::forEachField(*patched, [](NbtScanner::Field const&) { return true; }));
+    CHECK(NbtTree::decode(*patched) == expected);
+    // Fields that were not replaced keep their bytes.
+    NbtScanner::forEachField(data, [&](NbtScanner::Field const& field) {
+        if (!NbtScanner::findField(replacement, field.mName)) {
+            auto copy = NbtScanner::findField(*patched, field.mName);
+            CHECK(copy && copy->mType == field.mType && copy->mPayload == field.mPayload);
+        }
+        return true;
+    });
+}
+
+void checkStrings() {
+    auto data = makePlayerNbt("00000000-0000-0000-0000-000000000001", 4);
+    // Longer, shorter and empty strings move every field behind them.
+    NbtWriter replacement;
+    replacement.beginRoot();
+    replacement.field(TagType::String, "MsaId").string(std::string(300, 'm'));
+    replacement.field(TagType::String, "ServerId").string("s");
+    replacement.field(TagType::String, "SelfSignedId").string("");
+    replacement.end();
+    checkPatch(data, replacement.mData);
+    auto patched = NbtPatcher::patch(data, replacement.mData);
+    CHECK(patched && patched->size() == data.size() + 300 - 36 + 1 - 15);
+    CHECK(patched && NbtScanner::getString(*patched, "MsaId") == std::string(300, 'm'));
+    CHECK(patched && NbtScanner::getString(*patched, "ServerId") == "s");
+    CHECK(patched && NbtScanner::getString(*patched, "SelfSignedId") == "");
+    CHECK(patched && NbtScanner::getInt64(*patched, "UniqueID") == -4294967295);
+
+    // The longest string a field can hold.
+    NbtWriter longest;
+    longest.beginRoot().field(TagType::String, "MsaId").string(std::string(0xffff, 'x')).end();
+    checkPatch(data, longest.mData);
+}
+
+void checkFields() {
+    auto data = makePlayerNbt("00000000-0000-0000-0000-000000000001", 8);
+    // Replaces a list with a shorter one, changes the type of a field and appends a new one.
+    NbtWriter replacement;
+    replacement.beginRoot();
+    replacement.field(TagType::List, "Inventory").list(TagType::Compound, 1);
+    writeItem(replacement, 0, "minecraft:stick");
+    replacement.field(TagType::String, "PlayerLevel").string("thirty");
+    replacement.field(TagType::Compound, "Custom").field(TagType::Int, "Value").value((int32_t)1).end();
+    replacement.end();
+    checkPatch(data, replacement.mData);
+    auto patched = NbtPatcher::patch(data, replacement.mData);
+    CHECK(patched && NbtScanner::getString(*patched, "PlayerLevel") == "thirty");
+    CHECK(patched && NbtScanner::findField(*patched, "Custom"));
+
+    // Nothing to replace copies the data.
+    NbtWriter empty;
+    empty.beginRoot().end();
+    CHECK(NbtPatcher::patch(data, empty.mData) == data);
+    checkPatch(empty.mData, replacement.mData);
+}
+
+void checkMalformed() {
+    auto      data = makePlayerNbt("00000000-0000-0000-0000-000000000001", 2);
+    NbtWriter replacement;
+    replacement.beginRoot().field(TagType::Int, "PlayerLevel").value((int32_t)1).end();
+    for (size_t size = 0; size < data.size(); size += 7) {
+        CHECK(!NbtPatcher::patch(std::string_view(data).substr(0, size), replacement.mData));
+    }
+    for (size_t size = 0; size < replacement.mData.size(); size++) {
+        CHECK(!NbtPatcher::patch(data, std::string_view(replacement.mData).substr(0, size)));
+    }
+}
+
+// Random subsets of the fields of one player written over another.
+void checkRandom() {
+    auto         data  = makePlayerNbt("00000000-0000-0000-0000-000000000001", 6);
+    auto         other = makePlayerNbt("00000000-0000-0000-0000-000000000000002", 2);
+    std::mt19937 random(14);
+    for (int i = 0; i < 1000; i++) {
+        NbtWriter replacement;
+        replacement.beginRoot();
+        NbtScanner::forEachField(other, [&](NbtScanner::Field const& field) {
+            if (random() % 3 == 0) {
+                replacement.field(field.mType, field.mName);
+                replacement.mData.append(field.mPayload);
+            }
+            return true;
+        });
+        if (random() % 4 == 0) {
+            replacement.field(TagType::String, "Extra" + std::to_string(i)).string(std::string(random() % 64, 'e'));
+        }
+        replacement.end();
+        checkPatch(data, replacement.mData);
+    }
+}
+
+int main() {
+    checkStrings();
+    checkFields();
+    checkMalformed();
+    checkRandom();
+    return finishTest();
+}
@@ -0,0 +1,49 @@
+#include "NbtTree.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace GMLIB::PlayerAPI;
+
+// Reads the uuid and the unique id of every player record, by decoding each whole tag as forEachUuid used to and by
+// scanning it in place.
+
+double getMicrosecondsPerRecord(std::chrono::steady_clock::time_point start, size_t count) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / (double)count;
+}
+
+// Usage: NbtScannerBench [record count] [items per inventory]
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    int    items = argc > 2 ? std::atoi(argv[2]) : 36;
+
+    // Distinct records cycled through, so that the blobs do not all fit in the cache.
+    std::vector<std::string> records;
+    for (int i = 0; i < 1000; i++) {
+        records.push_back(makePlayerNbt("00000000-0000-0000-0000-" + std::to_string(100000000000 + i), items));
+    }
+
+    size_t found = 0;
+    auto   start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; i++) {
+        auto tree = NbtTree::decode(records[i % records.size()]);
+        found    += tree && tree->mCompound.contains("MsaId") && tree->mCompound.contains("UniqueID");
+    }
+    auto parseTime = getMicrosecondsPerRecord(start, count);
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; i++) {
+        auto& data  = records[i % records.size()];
+        found      += NbtScanner::getString(data, "MsaId") && NbtScanner::getInt64(data, "UniqueID");
+    }
+    auto scanTime = getMicrosecondsPerRecord(start, count);
+    if (found != count * 2) {
+        std::printf("Found %zu of %zu records\n", found, count * 2);
+        return 1;
+    }
+
+    std::printf("%zu records, %zu bytes each\n", count, records[0].size());
+    std::printf("  parse: %.2f us/record, %.1f ms total\n", parseTime, parseTime * (double)count / 1000);
+    std::printf("  scan:  %.2f us/record, %.1f ms total\n", scanTime, scanTime * (double)count / 1000);
+    return 0;
+}
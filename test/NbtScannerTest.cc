@@ -0,0 +1,156 @@
+#include "NbtTree.h"
+#include "TestCheck.h"
+#include <random>
+
+using namespace GMLIB::PlayerAPI;
+
+bool scanAll(std::string_view data) {
+    return NbtScanner::forEachField(data, [](NbtScanner::Field const&) { return true; });
+}
+
+std::string makeFixture() {
+    NbtWriter writer;
+    writer.beginRoot();
+    writer.field(TagType::Compound, "Outer").field(TagType::Compound, "Inner");
+    writer.field(TagType::String, "MsaId").string("nested").field(TagType::Int, "Depth").value((int32_t)2).end();
+    writer.field(TagType::List, "Empty").list(TagType::End, 0).end();
+    writer.field(TagType::List, "Items").list(TagType::Compound, 2);
+    writeItem(writer, 0, "minecraft:stone");
+    writeItem(writer, 1, "minecraft:dirt");
+    writer.field(TagType::List, "Nested").list(TagType::List, 2);
+    writer.list(TagType::Int, 2).value((int32_t)1).value((int32_t)2).list(TagType::String, 1).string("text");
+    writer.field(TagType::IntArray, "Ids").value((int32_t)3).value((int32_t)1).value((int32_t)2).value((int32_t)3);
+    writer.field(TagType::String, "MsaId").string("msa-id");
+    writer.field(TagType::Int64, "UniqueID").value((int64_t)-4294967295);
+    writer.field(TagType::Int, "Level").value((int32_t)7);
+    writer.field(TagType::String, "MsaId").string("duplicate");
+    writer.end();
+    return writer.mData;
+}
+
+void checkFields() {
+    auto                     data = makeFixture();
+    std::vector<std::string> names;
+    std::vector<TagType>     types;
+    CHECK(NbtScanner::forEachField(data, [&](NbtScanner::Field const& field) {
+        names.emplace_back(field.mName);
+        types.push_back(field.mType);
+        return true;
+    }));
+    std::vector<std::string> expected = {"Outer", "Items", "Nested", "Ids", "MsaId", "UniqueID", "Level", "MsaId"};
+    CHECK(names == expected);
+    CHECK(types[0] == TagType::Compound && types[1] == TagType::List && types[3] == TagType::IntArray);
+
+    // Only top level fields are found, the first of duplicates wins.
+    CHECK(NbtScanner::getString(data, "MsaId") == "msa-id");
+    CHECK(NbtScanner::getInt64(data, "UniqueID") == -4294967295);
+    CHECK(NbtScanner::getInt(data, "Level") == 7);
+    CHECK(!NbtScanner::getInt(data, "Depth"));
+    CHECK(!NbtScanner::getInt(data, "MsaId"));
+    CHECK(!NbtScanner::getString(data, "Missing"));
+
+    // The payload of a compound ends with its End tag, the next field starts right behind it.
+    auto outer = NbtScanner::findField(data, "Outer");
+    auto items = NbtScanner::findField(data, "Items");
+    CHECK(outer && items && outer->mPayload.back() == (char)TagType::End);
+    CHECK(outer && items && outer->mPayload.data() + outer->mPayload.size() == items->mName.data() - 3);
+    auto ids = NbtScanner::findField(data, "Ids");
+    CHECK(ids && ids->mPayload.size() == 16);
+
+    int visited = 0;
+    CHECK(NbtScanner::forEachField(data, [&](NbtScanner::Field const& field) {
+        visited++;
+        return field.mName != "Nested";
+    }));
+    CHECK(visited == 3);
+}
+
+void checkTruncated() {
+    auto data = makeFixture();
+    CHECK(scanAll(data));
+    for (size_t size = 0; size < data.size(); size++) {
+        CHECK(!scanAll(std::string_view(data).substr(0, size)));
+        CHECK(!NbtScanner::getString(std::string_view(data).substr(0, size), "Missing"));
+    }
+}
+
+// A root compound holding one field whose payload is written by the callback.
+template <typename T>
+std::string makeRoot(TagType type, T&& writePayload) {
+    NbtWriter writer;
+    writer.beginRoot().field(type, "Field");
+    writePayload(writer);
+    writer.end();
+    return writer.mData;
+}
+
+void checkOversized() {
+    // Lengths and counts past the end of the data.
+    CHECK(!scanAll(makeRoot(TagType::String, [](NbtWriter& writer) { writer.value((uint16_t)0xffff).string("abc"); })));
+    CHECK(!scanAll(makeRoot(TagType::ByteArray, [](NbtWriter& writer) { writer.value((int32_t)0x7fffffff); })));
+    CHECK(!scanAll(makeRoot(TagType::Int64Array, [](NbtWriter& writer) { writer.value((int32_t)0x7fffffff); })));
+    CHECK(!scanAll(makeRoot(TagType::List, [](NbtWriter& writer) { writer.list(TagType::Int64, 0x7fffffff); })));
+    CHECK(!scanAll(makeRoot(TagType::List, [](NbtWriter& writer) { writer.list(TagType::Compound, 0x7fffffff); })));
+    // Negative counts.
+    CHECK(!scanAll(makeRoot(TagType::IntArray, [](NbtWriter& writer) { writer.value((int32_t)-1); })));
+    CHECK(!scanAll(makeRoot(TagType::List, [](NbtWriter& writer) { writer.list(TagType::Byte, -1); })));
+    // A name longer than the data.
+    NbtWriter longName;
+    longName.beginRoot().value((uint8_t)TagType::Int).value((uint16_t)0xffff).value((int32_t)0).end();
+    CHECK(!scanAll(longName.mData));
+    // Unknown tag types, and a root that is not a compound.
+    CHECK(!scanAll(makeRoot((TagType)13, [](NbtWriter& writer) { writer.value((int32_t)0); })));
+    CHECK(!scanAll(makeRoot(TagType::List, [](NbtWriter& writer) { writer.list((TagType)13, 1); })));
+    CHECK(scanAll(makeRoot(TagType::List, [](NbtWriter& writer) { writer.list((TagType)13, 0); })));
+    CHECK(!scanAll(std::string("\x08\x00\x00\x00\x00", 5)));
+    CHECK(!scanAll(""));
+}
+
+void checkDepth() {
+    auto makeNested = [](int depth) {
+        return makeRoot(TagType::List, [depth](NbtWriter& writer) {
+            for (int i = 1; i < depth; i++) {
+                writer.list(TagType::List, 1);
+            }
+            writer.list(TagType::Int, 0);
+        });
+    };
+    CHECK(scanAll(makeNested(NbtScanner::MAX_DEPTH)));
+    CHECK(!scanAll(makeNested(NbtScanner::MAX_DEPTH + 1)));
+}
+
+// Randomly damaged fixtures are rejected exactly when the reference decoder rejects them.
+void checkAgainstDecoder() {
+    auto         data = makeFixture();
+    std::mt19937 random(11);
+    int          accepted = 0;
+    for (int i = 0; i < 100000; i++) {
+        auto damaged = data;
+        for (auto count = 1 + random() % 4; count > 0; count--) {
+            damaged[random() % damaged.size()] ^= (char)(1 << (random() % 8));
+        }
+        if (random() % 4 == 0) {
+            damaged.resize(random() % damaged.size());
+        }
+        auto tree    = NbtTree::decode(damaged);
+        bool scanned = scanAll(damaged);
+        CHECK(scanned == tree.has_value());
+        if (scanned && tree) {
+            accepted++;
+            auto msaId = tree->mCompound.find("MsaId");
+            if (msaId != tree->mCompound.end() && msaId->second.mType == TagType::String) {
+                CHECK(NbtScanner::getString(damaged, "MsaId") == msaId->second.mValue);
+            }
+        }
+    }
+    std::printf("%d of 100000 damaged fixtures still valid\n", accepted);
+}
+
+int main() {
+    checkFields();
+    checkTruncated();
+    checkOversized();
+    checkDepth();
+    checkAgainstDecoder();
+    return finishTest();
+}
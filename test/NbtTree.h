@@ -0,0 +1,263 @@
+#pragma once
+#include "Server/PlayerAPI/NbtScanner.h"
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Builds encoded NBT fixtures, and decodes them into a tree the way CompoundTag::fromBinaryNbt does, as the reference
+// the scanner and the patcher are compared against.
+
+using TagType = GMLIB::PlayerAPI::NbtScanner::TagType;
+
+class NbtWriter {
+public:
+    std::string mData;
+
+public:
+    template <typename T>
+    NbtWriter& value(T value) {
+        mData.append((char const*)&value, sizeof(T));
+        return *this;
+    }
+
+    NbtWriter& string(std::string_view value) {
+        this->value((uint16_t)value.size());
+        mData.append(value);
+        return *this;
+    }
+
+    // Type byte and name of a field.
+    NbtWriter& field(TagType type, std::string_view name) {
+        value((uint8_t)type);
+        return string(name);
+    }
+
+    NbtWriter& list(TagType elementType, int32_t count) {
+        value((uint8_t)elementType);
+        return value(count);
+    }
+
+    NbtWriter& beginRoot() { return field(TagType::Compound, ""); }
+
+    NbtWriter& end() { return value((uint8_t)TagType::End); }
+};
+
+// A decoded tag. Compounds are ordered by name and keep the first of duplicate names.
+struct NbtTree {
+    TagType                        mType = TagType::End;
+    // Numbers and arrays as encoded without their count, strings without their length.
+    std::string                    mValue;
+    TagType                        mElementType = TagType::End;
+    std::vector<NbtTree>           mList;
+    std::map<std::string, NbtTree> mCompound;
+
+    bool operator==(NbtTree const&) const = default;
+
+    static std::optional<NbtTree> decode(std::string_view data) {
+        size_t      position = 0;
+        std::string name;
+        NbtTree     root;
+        if (!readValue(data, position, root.mType) || root.mType != TagType::Compound
+            || !readString(data, position, name) || !root.decodePayload(data, position, 0)) {
+            return std::nullopt;
+        }
+        return root;
+    }
+
+    std::string encode() const {
+        std::string result;
+        result.push_back((char)TagType::Compound);
+        result.append(2, '\0');
+        encodePayload(result);
+        return result;
+    }
+
+private:
+    template <typename T>
+    static bool readValue(std::string_view data, size_t& position, T& value) {
+        if (data.size() - position < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data.data() + position, sizeof(T));
+        position += sizeof(T);
+        return true;
+    }
+
+    static bool readBytes(std::string_view data, size_t& position, uint64_t size, std::string& value) {
+        if (data.size() - position < size) {
+            return false;
+        }
+        value.assign(data.substr(position, (size_t)size));
+        position += (size_t)size;
+        return true;
+    }
+
+    static bool readString(std::string_view data, size_t& position, std::string& value) {
+        uint16_t size = 0;
+        return readValue(data, position, size) && readBytes(data, position, size, value);
+    }
+
+    static size_t getElementSize(TagType type) {
+        switch (type) {
+        case TagType::Byte:
+        case TagType::ByteArray:
+            return 1;
+        case TagType::Short:
+            return 2;
+        case TagType::Int:
+        case TagType::Float:
+        case TagType::IntArray:
+            return 4;
+        case TagType::Int64:
+        case TagType::Double:
+        case TagType::Int64Array:
+            return 8;
+        default:
+            return 0;
+        }
+    }
+
+    bool decodePayload(std::string_view data, size_t& position, int depth) {
+        if (depth > GMLIB::PlayerAPI::NbtScanner::MAX_DEPTH) {
+            return false;
+        }
+        int32_t count = 0;
+        switch (mType) {
+        case TagType::Byte:
+        case TagType::Short:
+        case TagType::Int:
+        case TagType::Int64:
+        case TagType::Float:
+        case TagType::Double:
+            return readBytes(data, position, getElementSize(mType), mValue);
+        case TagType::ByteArray:
+        case TagType::IntArray:
+        case TagType::Int64Array:
+            return readValue(data, position, count) && count >= 0
+                && readBytes(data, position, (uint64_t)count * getElementSize(mType), mValue);
+        case TagType::String:
+            return readString(data, position, mValue);
+        case TagType::List:
+            if (!readValue(data, position, mElementType) || !readValue(data, position, count) || count < 0) {
+                return false;
+            }
+            // Like the scanner, a list of End tags is empty whatever its count.
+            for (int32_t i = 0; i < count && mElementType != TagType::End; i++) {
+                if (data.size() - position < getElementSize(mElementType)) {
+                    return false;
+                }
+                auto& element = mList.emplace_back();
+                element.mType = mElementType;
+                if (!element.decodePayload(data, position, depth + 1)) {
+                    return false;
+                }
+            }
+            return true;
+        case TagType::Compound:
+            while (true) {
+                NbtTree     field;
+                std::string name;
+                if (!readValue(data, position, field.mType)) {
+                    return false;
+                }
+                if (field.mType == TagType::End) {
+                    return true;
+                }
+                if (!readString(data, position, name) || !field.decodePayload(data, position, depth + 1)) {
+                    return false;
+                }
+                mCompound.emplace(std::move(name), std::move(field));
+            }
+        default:
+            return false;
+        }
+    }
+
+    void encodePayload(std::string& result) const {
+        auto appendCount = [&](size_t count) {
+            auto value = (int32_t)count;
+            result.append((char const*)&value, sizeof(value));
+        };
+        switch (mType) {
+        case TagType::ByteArray:
+        case TagType::IntArray:
+        case TagType::Int64Array:
+            appendCount(mValue.size() / getElementSize(mType));
+            result.append(mValue);
+            return;
+        case TagType::String: {
+            auto size = (uint16_t)mValue.size();
+            result.append((char const*)&size, sizeof(size));
+            result.append(mValue);
+            return;
+        }
+        case TagType::List:
+            result.push_back((char)mElementType);
+            appendCount(mList.size());
+            for (auto& element : mList) {
+                element.encodePayload(result);
+            }
+            return;
+        case TagType::Compound:
+            for (auto& [name, field] : mCompound) {
+                auto size = (uint16_t)name.size();
+                result.push_back((char)field.mType);
+                result.append((char const*)&size, sizeof(size));
+                result.append(name);
+                field.encodePayload(result);
+            }
+            result.push_back((char)TagType::End);
+            return;
+        default:
+            result.append(mValue);
+            return;
+        }
+    }
+};
+
+// An item stack as the player inventories store it.
+inline void writeItem(NbtWriter& writer, int slot, std::string_view name) {
+    writer.field(TagType::Byte, "Count").value((uint8_t)1);
+    writer.field(TagType::Short, "Damage").value((int16_t)0);
+    writer.field(TagType::String, "Name").string(name);
+    writer.field(TagType::Byte, "Slot").value((uint8_t)slot);
+    writer.field(TagType::Compound, "tag");
+    writer.field(TagType::List, "ench").list(TagType::Compound, 2);
+    for (int16_t i = 0; i < 2; i++) {
+        writer.field(TagType::Short, "id").value(i).field(TagType::Short, "lvl").value((int16_t)3).end();
+    }
+    writer.field(TagType::String, "CustomName").string("Item " + std::to_string(slot)).end();
+    writer.end();
+}
+
+// A player tag with the fields forEachUuid and the player id index read, and itemsPerInventory items in each of the
+// inventory and the ender chest.
+inline std::string makePlayerNbt(std::string_view msaId, int itemsPerInventory) {
+    NbtWriter writer;
+    writer.beginRoot();
+    writer.field(TagType::Compound, "Abilities");
+    writer.field(TagType::Byte, "flying").value((uint8_t)0);
+    writer.field(TagType::Float, "walkSpeed").value(0.1f).end();
+    writer.field(TagType::List, "Attributes").list(TagType::Compound, 3);
+    for (auto name : {"minecraft:health", "minecraft:hunger", "minecraft:movement"}) {
+        writer.field(TagType::Float, "Base").value(20.0f).field(TagType::String, "Name").string(name).end();
+    }
+    for (auto inventory : {"EnderChestInventory", "Inventory"}) {
+        writer.field(TagType::List, inventory).list(TagType::Compound, itemsPerInventory);
+        for (int i = 0; i < itemsPerInventory; i++) {
+            writeItem(writer, i, "minecraft:diamond_sword");
+        }
+    }
+    writer.field(TagType::String, "MsaId").string(msaId);
+    writer.field(TagType::List, "Pos").list(TagType::Float, 3).value(0.5f).value(64.0f).value(0.5f);
+    writer.field(TagType::String, "SelfSignedId").string("");
+    writer.field(TagType::String, "ServerId").string("player_server_0");
+    writer.field(TagType::Int64, "UniqueID").value((int64_t)-4294967295);
+    writer.field(TagType::Int, "PlayerLevel").value((int32_t)30);
+    writer.end();
+    return writer.mData;
+}
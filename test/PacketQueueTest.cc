@@ -0,0 +1,57 @@
+#include "Server/PlayerAPI/PacketQueue.h"
+#include "TestCheck.h"
+
+using namespace GMLIB::PlayerAPI;
+
+constexpr int ADD_PACKET    = 15;
+constexpr int REMOVE_PACKET = 14;
+
+std::vector<std::string> flush(PacketQueue& queue) {
+    std::vector<std::string> sent;
+    queue.flush([&](PacketQueue::Entry const& entry) { sent.push_back(entry.mData); });
+    return sent;
+}
+
+void checkSupersede() {
+    PacketQueue queue;
+    queue.push(1, "a");
+    CHECK(!queue.push(2, "title 1", "title"));
+    queue.push(1, "b");
+    CHECK(queue.push(2, "title 2", "title") == 7);
+    // An empty key never supersedes.
+    CHECK(!queue.push(1, "c"));
+    CHECK(queue.size() == 4);
+    CHECK((flush(queue) == std::vector<std::string>{"a", "b", "title 2", "c"}));
+    CHECK(queue.empty() && flush(queue).empty());
+    CHECK(!queue.push(2, "title 3", "title"));
+}
+
+// The keys FloatingTextAPI uses, one for the adds and one for the removes of a floating text.
+void checkFloatingText() {
+    PacketQueue queue;
+    auto        add    = [&](std::string text) { queue.push(ADD_PACKET, std::move(text), "floatingtext:add:5"); };
+    auto        remove = [&] { queue.push(REMOVE_PACKET, "remove", "floatingtext:remove:5"); };
+    // Refreshing the text removes the old actor and adds it again.
+    add("old");
+    queue.flush([](PacketQueue::Entry const&) {});
+    remove();
+    add("new");
+    CHECK((flush(queue) == std::vector<std::string>{"remove", "new"}));
+    // Two refreshes in one tick only send the last text, behind the remove.
+    add("first");
+    remove();
+    add("second");
+    remove();
+    add("third");
+    CHECK((flush(queue) == std::vector<std::string>{"remove", "third"}));
+    // The last call of the tick is sent last.
+    add("shown");
+    remove();
+    CHECK((flush(queue) == std::vector<std::string>{"shown", "remove"}));
+}
+
+int main() {
+    checkSupersede();
+    checkFloatingText();
+    return finishTest();
+}
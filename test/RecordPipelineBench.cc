@@ -0,0 +1,39 @@
+#include "Server/PlayerAPI/RecordPipeline.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace GMLIB::PlayerAPI;
+
+// Records per second handed from one producer to the scan workers, as scanOfflinePlayerRecords does.
+
+// Usage: RecordPipelineBench [record count] [record bytes]
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    size_t size  = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10000;
+
+    std::string value(size, 'x');
+    std::printf("%zu records of %zu bytes\n", count, size);
+    for (uint32_t workers : {0u, 1u, 2u, 4u}) {
+        std::vector<uint64_t> hashes(std::max(workers, 1u) * 8);
+        auto                  start = std::chrono::steady_clock::now();
+        RecordPipeline        pipeline(
+            [&](uint32_t workerIndex, std::string_view, std::string_view value) {
+                // Stands in for scanning the tag, each worker sums into its own cache line.
+                uint64_t hash = 14695981039346656037ull;
+                for (auto c : value) {
+                    hash = (hash ^ (uint8_t)c) * 1099511628211ull;
+                }
+                hashes[workerIndex * 8] += hash;
+            },
+            workers
+        );
+        for (size_t i = 0; i < count; i++) {
+            pipeline.push("player_server_" + std::to_string(i), value);
+        }
+        pipeline.finish();
+        auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::printf("  %u workers: %8.0f records/s\n", workers, (double)count / seconds);
+    }
+    return 0;
+}
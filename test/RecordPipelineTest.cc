@@ -0,0 +1,95 @@
+#include "Server/PlayerAPI/RecordPipeline.h"
+#include "TestCheck.h"
+#include <algorithm>
+#include <stdexcept>
+
+using namespace GMLIB::PlayerAPI;
+
+std::string getValue(int record) { return std::string(record % 300, (char)('a' + record % 26)); }
+
+// Every record reaches the visitor once with its own key and value, whatever the workers and batches.
+void checkRecords(uint32_t workerCount, size_t batchSize, size_t queueCapacity) {
+    constexpr int                RECORD_COUNT = 10000;
+    std::mutex                   mutex;
+    std::vector<int>             visits(RECORD_COUNT);
+    std::vector<std::thread::id> threads(std::max<uint32_t>(workerCount, 1));
+    int                          wrongValues  = 0;
+    int                          wrongWorkers = 0;
+    RecordPipeline               pipeline(
+        [&](uint32_t workerIndex, std::string_view key, std::string_view value) {
+            auto            record = std::stoi(std::string(key.substr(14)));
+            std::lock_guard lock(mutex);
+            visits[record]++;
+            wrongValues += value != getValue(record);
+            // Each index belongs to one thread.
+            if (workerIndex >= threads.size()) {
+                wrongWorkers++;
+            } else if (threads[workerIndex] == std::thread::id()) {
+                threads[workerIndex] = std::this_thread::get_id();
+            } else {
+                wrongWorkers += threads[workerIndex] != std::this_thread::get_id();
+            }
+        },
+        workerCount,
+        batchSize,
+        queueCapacity
+    );
+    CHECK(pipeline.getWorkerCount() == std::max<uint32_t>(workerCount, 1));
+    for (int i = 0; i < RECORD_COUNT; i++) {
+        pipeline.push("player_server_" + std::to_string(i), getValue(i));
+    }
+    pipeline.finish();
+    pipeline.finish();
+    CHECK(std::all_of(visits.begin(), visits.end(), [](int count) { return count == 1; }));
+    CHECK(wrongValues == 0);
+    CHECK(wrongWorkers == 0);
+    CHECK(pipeline.getFailedCount() == 0);
+    if (workerCount == 0) {
+        CHECK(threads[0] == std::this_thread::get_id());
+    }
+}
+
+void checkFailures() {
+    std::atomic<int> visited;
+    RecordPipeline   pipeline(
+        [&](uint32_t, std::string_view key, std::string_view) {
+            visited++;
+            if (key.ends_with('7')) {
+                throw std::runtime_error("corrupted record");
+            }
+        },
+        3,
+        8
+    );
+    for (int i = 0; i < 1000; i++) {
+        pipeline.push(std::to_string(i), {});
+    }
+    pipeline.finish();
+    // A throwing record is counted and the rest of its batch still runs.
+    CHECK(visited == 1000);
+    CHECK(pipeline.getFailedCount() == 100);
+}
+
+void checkUnfinished() {
+    // Records pushed and never finished are processed when the pipeline is destroyed.
+    std::atomic<int> visited;
+    {
+        RecordPipeline pipeline([&](uint32_t, std::string_view, std::string_view) { visited++; }, 2, 64);
+        for (int i = 0; i < 100; i++) {
+            pipeline.push("key", "value");
+        }
+    }
+    CHECK(visited == 100);
+    CHECK(RecordPipeline::resolveWorkerCount(5) == 5);
+    CHECK(RecordPipeline::resolveWorkerCount(0) >= 1);
+}
+
+int main() {
+    checkRecords(0, 64, 0);
+    checkRecords(1, 1, 1);
+    checkRecords(4, 64, 0);
+    checkRecords(8, 7, 2);
+    checkFailures();
+    checkUnfinished();
+    return finishTest();
+}
@@ -0,0 +1,104 @@
+#include "Server/ScoreboardAPI/ScoreCache.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace GMLIB::ScoreboardAPI;
+
+// Score reads through the cache against the uncached path, which copies every score of the id as getIdScores does
+// and searches them for the objective. Then the hit rate of a hot set under one-off reads, with the cache evicting
+// entry by entry and with the cache emptied whenever it is full.
+
+struct Score {
+    void const* mObjective;
+    int         mScore;
+};
+
+constexpr int OBJECTIVE_COUNT = 20;
+
+std::unordered_map<int64_t, std::vector<Score>> mScores;
+int                                             mObjectives[OBJECTIVE_COUNT];
+volatile int64_t                                mSink;
+
+std::optional<int> readUncached(void const* objective, int64_t id) {
+    auto it = mScores.find(id);
+    if (it == mScores.end()) {
+        return {};
+    }
+    auto scores = it->second;
+    for (auto& score : scores) {
+        if (score.mObjective == objective) {
+            return score.mScore;
+        }
+    }
+    return {};
+}
+
+std::optional<int> readCached(ScoreCache& cache, void const* objective, int64_t id, bool clearWhenFull) {
+    if (auto cached = cache.find(objective, id)) {
+        return *cached;
+    }
+    auto score = readUncached(objective, id);
+    if (clearWhenFull && cache.size() >= 4096) {
+        cache.clear();
+    }
+    cache.insert(objective, id, score);
+    return score;
+}
+
+template <typename Fn>
+double getNanosecondsPerRead(size_t reads, Fn&& read) {
+    std::mt19937 random(20);
+    int64_t      sum   = 0;
+    auto         start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < reads; i++) {
+        auto objective = &mObjectives[random() % OBJECTIVE_COUNT];
+        auto id        = (int64_t)(random() % 1000);
+        sum           += read(objective, id).value_or(0);
+    }
+    auto time = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    mSink     = sum;
+    return time / (double)reads;
+}
+
+// 1000 hot scores read every tick and 2000 one-off reads, through a cache of 4096 entries.
+double getHotHitRate(bool clearWhenFull) {
+    ScoreCache cache(4096);
+    uint64_t   hotHits = 0;
+    for (int tick = 0; tick < 200; tick++) {
+        for (int64_t id = 0; id < 1000; id++) {
+            hotHits += cache.find(&mObjectives[0], id) != nullptr;
+            readCached(cache, &mObjectives[0], id, clearWhenFull);
+        }
+        for (int64_t id = 0; id < 2000; id++) {
+            readCached(cache, &mObjectives[1], 1000 + tick * 2000 + id, clearWhenFull);
+        }
+    }
+    return (double)hotHits / (1000.0 * 200);
+}
+
+// Usage: ScoreCacheBench [reads]
+int main(int argc, char** argv) {
+    size_t reads = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    for (int64_t id = 0; id < 1000; id++) {
+        for (int i = 0; i < OBJECTIVE_COUNT; i++) {
+            mScores[id].push_back({&mObjectives[i], (int)id + i});
+        }
+    }
+
+    ScoreCache cache;
+    auto       uncached = getNanosecondsPerRead(reads, readUncached);
+    auto       cached   = getNanosecondsPerRead(reads, [&](void const* objective, int64_t id) {
+        return readCached(cache, objective, id, false);
+    });
+    std::printf("%zu reads of %d objectives x 1000 ids\n", reads, OBJECTIVE_COUNT);
+    std::printf("  uncached: %.1f ns/read\n", uncached);
+    std::printf("  cached:   %.1f ns/read, %.4f hit rate\n", cached, 1 - (double)cache.getStatistics().mMisses / reads);
+    std::printf("Hot scores under one-off reads\n");
+    std::printf("  evicting one entry per insert: %.3f hit rate\n", getHotHitRate(false));
+    std::printf("  emptying the cache when full:  %.3f hit rate\n", getHotHitRate(true));
+    return 0;
+}
@@ -0,0 +1,143 @@
+#include "Server/ScoreboardAPI/ScoreCache.h"
+#include "TestCheck.h"
+#include <map>
+#include <random>
+
+using namespace GMLIB::ScoreboardAPI;
+
+// Objectives are only compared by address.
+int mKills;
+int mDeaths;
+
+void checkLookups() {
+    ScoreCache cache;
+    CHECK(cache.find(&mKills, 1) == nullptr);
+    cache.insert(&mKills, 1, 10);
+    cache.insert(&mKills, 2, std::nullopt);
+    cache.insert(&mDeaths, 1, 20);
+    auto score = cache.find(&mKills, 1);
+    CHECK(score && *score == 10);
+    // A missing score is cached too.
+    auto missing = cache.find(&mKills, 2);
+    CHECK(missing && !*missing);
+    CHECK(cache.find(&mDeaths, 1) && *cache.find(&mDeaths, 1) == 20);
+    cache.insert(&mKills, 1, 11);
+    CHECK(*cache.find(&mKills, 1) == 11 && cache.size() == 3);
+
+    auto& statistics = cache.getStatistics();
+    CHECK(statistics.mHits == 5 && statistics.mMisses == 1);
+    cache.resetStatistics();
+    CHECK(statistics.mHits == 0 && statistics.mMisses == 0);
+}
+
+void checkInvalidation() {
+    ScoreCache cache;
+    for (int64_t id = 0; id < 10; id++) {
+        cache.insert(&mKills, id, (int)id);
+    }
+    cache.invalidate(&mKills, 3);
+    cache.invalidate(&mKills, 9);
+    cache.invalidate(&mKills, 42);
+    cache.invalidate(&mDeaths, 0);
+    CHECK(cache.getStatistics().mInvalidations == 2 && cache.size() == 8);
+    CHECK(!cache.find(&mKills, 3) && !cache.find(&mKills, 9));
+    // The entries moved into the gaps are still found.
+    for (int64_t id : {0, 1, 2, 4, 5, 6, 7, 8}) {
+        auto score = cache.find(&mKills, id);
+        CHECK(score && *score == id);
+    }
+    cache.clear();
+    CHECK(cache.size() == 0 && cache.getStatistics().mInvalidations == 10);
+    CHECK(!cache.find(&mKills, 0));
+}
+
+void checkEviction() {
+    ScoreCache cache(4);
+    for (int64_t id = 0; id < 4; id++) {
+        cache.insert(&mKills, id, (int)id);
+    }
+    // The entries read since the hand passed get a second chance, the unread one goes.
+    cache.find(&mKills, 0);
+    cache.find(&mKills, 1);
+    cache.find(&mKills, 3);
+    cache.insert(&mKills, 4, 4);
+    CHECK(cache.size() == 4 && cache.getStatistics().mEvictions == 1);
+    CHECK(!cache.find(&mKills, 2));
+    CHECK(cache.find(&mKills, 0) && cache.find(&mKills, 1) && cache.find(&mKills, 3) && cache.find(&mKills, 4));
+    // With everything read the hand goes round once and evicts where it started.
+    cache.insert(&mKills, 5, 5);
+    CHECK(cache.size() == 4 && cache.getStatistics().mEvictions == 2);
+
+    ScoreCache disabled(0);
+    disabled.insert(&mKills, 1, 1);
+    CHECK(disabled.size() == 0 && !disabled.find(&mKills, 1));
+}
+
+// A hot set read every tick stays cached while one-off reads stream through the rest of the cache.
+void checkHotSet() {
+    ScoreCache cache(1000);
+    for (int tick = 0; tick < 100; tick++) {
+        for (int64_t id = 0; id < 500; id++) {
+            if (!cache.find(&mKills, id)) {
+                cache.insert(&mKills, id, (int)id);
+            }
+        }
+        for (int64_t id = 0; id < 400; id++) {
+            auto cold = 1000000 + tick * 400 + id;
+            if (!cache.find(&mDeaths, cold)) {
+                cache.insert(&mDeaths, cold, 0);
+            }
+        }
+    }
+    // Only the first tick misses the hot ids.
+    CHECK(cache.getStatistics().mHits == 500 * 99);
+    CHECK(cache.size() == 1000);
+}
+
+// Random reads, writes and resets against the true scores, the cache never serves a stale score.
+void checkRandom() {
+    ScoreCache                              cache(64);
+    std::map<std::pair<int*, int64_t>, int> scores;
+    std::mt19937                            random(20);
+    int                                     stale = 0;
+    for (int i = 0; i < 200000; i++) {
+        auto objective = random() % 2 ? &mKills : &mDeaths;
+        auto id        = (int64_t)(random() % 200);
+        auto key       = std::make_pair(objective, id);
+        switch (random() % 4) {
+        case 0:
+            // The score hooks invalidate on every change.
+            scores[key] = (int)(random() % 1000);
+            cache.invalidate(objective, id);
+            break;
+        case 1:
+            if (random() % 100 == 0) {
+                scores.clear();
+                cache.clear();
+            }
+            break;
+        default: {
+            auto it       = scores.find(key);
+            auto expected = it == scores.end() ? std::nullopt : std::optional<int>(it->second);
+            if (auto cached = cache.find(objective, id)) {
+                stale += *cached != expected;
+            } else {
+                cache.insert(objective, id, expected);
+            }
+            break;
+        }
+        }
+        CHECK(cache.size() <= 64);
+    }
+    CHECK(stale == 0);
+    CHECK(cache.getStatistics().mEvictions > 0);
+}
+
+int main() {
+    checkLookups();
+    checkInvalidation();
+    checkEviction();
+    checkHotSet();
+    checkRandom();
+    return finishTest();
+}
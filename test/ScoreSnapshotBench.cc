@@ -0,0 +1,69 @@
+#include "Server/ScoreboardAPI/ScoreSnapshot.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+
+using namespace GMLIB::ScoreboardAPI;
+
+// Only counts what it reads, so that the reader itself is measured.
+struct CountingHandler : ScoreSnapshotReader::Handler {
+    uint64_t mIdentities = 0;
+    uint64_t mScores     = 0;
+
+    bool onObjective(uint32_t, SnapshotObjective const&) override { return true; }
+
+    bool onIdentities(std::vector<SnapshotIdentity> const& identities) override {
+        mIdentities += identities.size();
+        return true;
+    }
+
+    bool onScores(uint32_t, std::vector<SnapshotScore> const& scores) override {
+        mScores += scores.size();
+        return true;
+    }
+};
+
+double getMilliseconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Usage: ScoreSnapshotBench [identity count], every identity has a score in each of the 3 objectives.
+int main(int argc, char** argv) {
+    uint64_t identityCount  = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    uint32_t objectiveCount = 3;
+
+    auto               start = std::chrono::steady_clock::now();
+    std::ostringstream output;
+    {
+        ScoreSnapshotWriter writer(output);
+        for (uint32_t objective = 0; objective < objectiveCount; objective++) {
+            writer.addObjective({"objective" + std::to_string(objective), "", "dummy"});
+        }
+        for (uint64_t id = 0; id < identityCount; id++) {
+            writer.writeIdentity({(int64_t)id, SnapshotIdentity::Type::Player, (int64_t)(id * 7919), {}});
+            for (uint32_t objective = 0; objective < objectiveCount; objective++) {
+                writer.writeScore(objective, (int64_t)id, (int)(id * (objective + 1)));
+            }
+        }
+        if (!writer.finish()) {
+            return 1;
+        }
+    }
+    auto writeTime = getMilliseconds(start);
+    auto data      = std::move(output).str();
+
+    start = std::chrono::steady_clock::now();
+    std::istringstream input(std::move(data));
+    CountingHandler    handler;
+    if (!ScoreSnapshotReader(input).read(handler) || handler.mScores != identityCount * objectiveCount) {
+        return 1;
+    }
+    auto readTime = getMilliseconds(start);
+
+    auto scores = (double)(identityCount * objectiveCount);
+    std::printf("%llu scores, %zu bytes\n", (unsigned long long)scores, input.str().size());
+    std::printf("write: %.1f ms, %.1f M scores/s\n", writeTime, scores / writeTime / 1000);
+    std::printf("read:  %.1f ms, %.1f M scores/s\n", readTime, scores / readTime / 1000);
+    return 0;
+}
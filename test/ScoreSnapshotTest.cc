@@ -0,0 +1,87 @@
+#include "StandInScoreboard.h"
+#include "TestCheck.h"
+#include <climits>
+#include <random>
+#include <sstream>
+
+using namespace GMLIB::ScoreboardAPI;
+
+StandInScoreboard makeScoreboard(size_t identityCount, uint32_t seed) {
+    StandInScoreboard scoreboard;
+    scoreboard.mObjectives = {
+        {"money",  "Money",   "dummy"          },
+        {"kills",  "§cKills", "playerKillCount"},
+        {"sparse", "",        "dummy"          }
+    };
+    scoreboard.mScores.resize(scoreboard.mObjectives.size());
+    std::mt19937_64 random(seed);
+    int64_t         id = -(int64_t)identityCount / 2;
+    for (size_t i = 0; i < identityCount; i++) {
+        id += 1 + (int64_t)(random() % 3);
+        SnapshotIdentity identity{id, (SnapshotIdentity::Type)(1 + i % 3), 0, {}};
+        if (identity.mType == SnapshotIdentity::Type::FakePlayer) {
+            identity.mName = "fake_" + std::to_string(i);
+        } else {
+            identity.mUniqueId = (int64_t)random();
+        }
+        scoreboard.mIdentities.emplace(id, identity);
+        scoreboard.mScores[0][id] = (int)random();
+        if (i % 4 != 0) {
+            scoreboard.mScores[1][id] = i % 5 == 0 ? INT_MIN : i % 7 == 0 ? INT_MAX : (int)(random() % 100);
+        }
+        // Fills its blocks at other points than the identity blocks.
+        if (i % 2 == 1) {
+            scoreboard.mScores[2][id] = -(int)i;
+        }
+    }
+    return scoreboard;
+}
+
+void checkRoundTrip(size_t identityCount) {
+    auto               exported = makeScoreboard(identityCount, (uint32_t)identityCount);
+    std::ostringstream output;
+    CHECK(exported.write(output));
+    std::istringstream input(output.str());
+    StandInScoreboard  imported;
+    CHECK(ScoreSnapshotReader(input).read(imported));
+    CHECK(imported.mDroppedScores == 0);
+    CHECK(imported.mObjectives.size() == exported.mObjectives.size());
+    for (size_t i = 0; i < imported.mObjectives.size() && i < exported.mObjectives.size(); i++) {
+        CHECK(imported.mObjectives[i].mName == exported.mObjectives[i].mName);
+        CHECK(imported.mObjectives[i].mDisplayName == exported.mObjectives[i].mDisplayName);
+        CHECK(imported.mObjectives[i].mCriteria == exported.mObjectives[i].mCriteria);
+    }
+    CHECK(imported.mIdentities.size() == exported.mIdentities.size());
+    for (auto& [id, identity] : exported.mIdentities) {
+        auto it = imported.mIdentities.find(id);
+        CHECK(it != imported.mIdentities.end() && it->second.mType == identity.mType
+              && it->second.mUniqueId == identity.mUniqueId && it->second.mName == identity.mName);
+    }
+    CHECK(imported.mScores == exported.mScores);
+}
+
+void checkRejected() {
+    auto               exported = makeScoreboard(300, 1);
+    std::ostringstream output;
+    CHECK(exported.write(output));
+    auto data = output.str();
+    for (size_t size = 0; size < data.size(); size++) {
+        std::istringstream input(data.substr(0, size));
+        StandInScoreboard  imported;
+        CHECK(!ScoreSnapshotReader(input).read(imported));
+    }
+    auto foreign = data;
+    foreign[0]   = 'X';
+    std::istringstream input(foreign);
+    StandInScoreboard  imported;
+    CHECK(!ScoreSnapshotReader(input).read(imported));
+}
+
+int main() {
+    checkRoundTrip(0);
+    checkRoundTrip(1);
+    checkRoundTrip(ScoreSnapshotWriter::BLOCK_SIZE);
+    checkRoundTrip(ScoreSnapshotWriter::BLOCK_SIZE * 5 + 17);
+    checkRejected();
+    return finishTest();
+}
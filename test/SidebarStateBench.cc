@@ -0,0 +1,152 @@
+#include "Server/PlayerAPI/SidebarState.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace GMLIB::PlayerAPI;
+
+// Packets and bytes per sidebar update, resending the whole sidebar as setClientSidebar did and sending the diff as
+// SidebarAPI does, for players refreshing a 15 line sidebar every second.
+
+constexpr std::string_view SIDEBAR_OBJECTIVE = "GMLIB_SIDEBAR_API";
+
+// The parts of BinaryStream the sidebar packets use.
+struct PacketWriter {
+    std::string mData;
+
+    void writeUnsignedVarInt(uint64_t value) {
+        do {
+            auto byte   = (char)(value & 0x7f);
+            value     >>= 7;
+            mData.push_back(value ? (char)(byte | 0x80) : byte);
+        } while (value);
+    }
+
+    void writeVarInt64(int64_t value) { writeUnsignedVarInt(((uint64_t)value << 1) ^ (uint64_t)(value >> 63)); }
+
+    void writeString(std::string_view value) {
+        writeUnsignedVarInt(value.size());
+        mData.append(value);
+    }
+
+    void writeSignedInt(int32_t value) { mData.append((char const*)&value, sizeof(value)); }
+};
+
+size_t getDisplaySize(std::string_view title, int sortOrder) {
+    PacketWriter writer;
+    writer.writeString("sidebar");
+    writer.writeString(SIDEBAR_OBJECTIVE);
+    writer.writeString(title);
+    writer.writeString("dummy");
+    writer.writeVarInt64(sortOrder);
+    return writer.mData.size();
+}
+
+size_t getScoresSize(std::vector<SidebarState::Entry> const& entries, bool remove) {
+    PacketWriter writer;
+    writer.mData.push_back(remove ? 1 : 0);
+    writer.writeUnsignedVarInt(entries.size());
+    for (auto& entry : entries) {
+        writer.writeVarInt64(entry.mId);
+        writer.writeString(SIDEBAR_OBJECTIVE);
+        writer.writeSignedInt(entry.mScore);
+        if (!remove) {
+            // FakePlayer identity.
+            writer.mData.push_back(3);
+            writer.writeString(entry.mText);
+        }
+    }
+    return writer.mData.size();
+}
+
+struct Traffic {
+    size_t mPackets = 0;
+    size_t mBytes   = 0;
+};
+
+// Edits the lines the way a scoreboard plugin does between refreshes.
+using Edit = void (*)(std::vector<std::pair<std::string, int>>& lines, std::mt19937& random, int second);
+
+void runScenario(char const* name, Edit edit, size_t playerCount, int seconds) {
+    std::vector<SidebarState>                             states(playerCount);
+    std::vector<std::vector<std::pair<std::string, int>>> lines(playerCount);
+    for (size_t i = 0; i < playerCount; i++) {
+        lines[i].emplace_back("Time: 00:00", 15);
+        for (int line = 1; line < 15; line++) {
+            lines[i].emplace_back("Stat " + std::to_string(line) + ": " + std::to_string(i), 15 - line);
+        }
+    }
+    std::mt19937 random(1);
+    Traffic      full;
+    Traffic      diffed;
+    double       diffTime = 0;
+    for (int second = 0; second < seconds; second++) {
+        for (size_t i = 0; i < playerCount; i++) {
+            if (second) {
+                edit(lines[i], random, second);
+            }
+            // The whole sidebar: the objective displayed twice, then every line under new ids.
+            std::vector<SidebarState::Entry> entries;
+            for (auto& [text, score] : lines[i]) {
+                entries.push_back({-2, text, score});
+            }
+            full.mPackets += 3;
+            full.mBytes   += getDisplaySize("Server", 1) * 2 + getScoresSize(entries, false);
+
+            auto start  = std::chrono::steady_clock::now();
+            auto diff   = states[i].update("Server", lines[i], 1);
+            diffTime   += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+            if (diff.mDisplay) {
+                diffed.mPackets++;
+                diffed.mBytes += getDisplaySize("Server", 1);
+            }
+            if (!diff.mRemoved.empty()) {
+                diffed.mPackets++;
+                diffed.mBytes += getScoresSize(diff.mRemoved, true);
+            }
+            if (!diff.mChanged.empty()) {
+                diffed.mPackets++;
+                diffed.mBytes += getScoresSize(diff.mChanged, false);
+            }
+        }
+    }
+    auto updates = (double)(playerCount * seconds);
+    std::printf("%s\n", name);
+    std::printf("  full:  %.2f packets, %6.1f bytes per update\n", full.mPackets / updates, full.mBytes / updates);
+    std::printf(
+        "  diff:  %.2f packets, %6.1f bytes per update, %.2f us to diff\n",
+        diffed.mPackets / updates,
+        diffed.mBytes / updates,
+        diffTime / updates
+    );
+}
+
+// Usage: SidebarStateBench [player count] [seconds]
+int main(int argc, char** argv) {
+    size_t playerCount = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 300;
+    int    seconds     = argc > 2 ? std::atoi(argv[2]) : 60;
+
+    std::printf("%zu players, 15 lines, refreshed every second for %d seconds\n", playerCount, seconds);
+    runScenario("Nothing changes", [](auto&, auto&, int) {}, playerCount, seconds);
+    runScenario(
+        "Two scores change",
+        [](auto& lines, auto& random, int) {
+            lines[1 + random() % 14].second++;
+            lines[1 + random() % 14].second++;
+        },
+        playerCount,
+        seconds
+    );
+    runScenario(
+        "A clock line ticks",
+        [](auto& lines, auto&, int second) {
+            char time[32];
+            std::snprintf(time, sizeof(time), "Time: %02d:%02d", second / 60, second % 60);
+            lines[0].first = time;
+        },
+        playerCount,
+        seconds
+    );
+    return 0;
+}
@@ -0,0 +1,160 @@
+#include "Server/PlayerAPI/SidebarState.h"
+#include "TestCheck.h"
+#include <algorithm>
+#include <map>
+#include <random>
+
+using namespace GMLIB::PlayerAPI;
+
+using Lines = std::vector<std::pair<std::string, int>>;
+
+// What the client shows after receiving the packets of each diff.
+struct Client {
+    std::map<int64_t, std::pair<std::string, int>> mLines;
+
+    void apply(SidebarState::Diff const& diff) {
+        if (diff.mDisplay) {
+            mLines.clear();
+        }
+        for (auto& entry : diff.mRemoved) {
+            mLines.erase(entry.mId);
+        }
+        for (auto& entry : diff.mChanged) {
+            mLines[entry.mId] = {entry.mText, entry.mScore};
+        }
+    }
+
+    bool shows(Lines lines) const {
+        Lines shown;
+        for (auto& [id, line] : mLines) {
+            shown.push_back(line);
+        }
+        std::sort(lines.begin(), lines.end());
+        std::sort(shown.begin(), shown.end());
+        return shown == lines;
+    }
+};
+
+int64_t getId(SidebarState const& state, std::string const& text, size_t occurrence = 0) {
+    auto it = state.getEntries().find({text, occurrence});
+    return it == state.getEntries().end() ? 0 : it->second.mId;
+}
+
+void checkDiffs() {
+    SidebarState state;
+    Client       client;
+    Lines        lines = {{"Kills", 3}, {"Deaths", 1}, {"Coins", 250}};
+    auto         diff  = state.update("Stats", lines, 1);
+    client.apply(diff);
+    CHECK(diff.mDisplay && diff.mChanged.size() == 3 && diff.mRemoved.empty());
+    CHECK(client.shows(lines));
+    for (auto& entry : diff.mChanged) {
+        CHECK(entry.mId <= -2);
+    }
+    auto kills = getId(state, "Kills");
+    auto coins = getId(state, "Coins");
+    CHECK(kills && coins && kills != coins);
+    CHECK(state.update("Stats", lines, 1).empty());
+
+    // A score change resends the line under its id.
+    lines[0].second = 4;
+    diff            = state.update("Stats", lines, 1);
+    client.apply(diff);
+    CHECK(!diff.mDisplay && diff.mChanged.size() == 1 && diff.mRemoved.empty());
+    CHECK(diff.mChanged[0].mId == kills && diff.mChanged[0].mScore == 4);
+    CHECK(client.shows(lines));
+
+    // A text change is a new line, the old one is removed.
+    lines[2].first = "Gems";
+    diff           = state.update("Stats", lines, 1);
+    client.apply(diff);
+    CHECK(!diff.mDisplay && diff.mChanged.size() == 1 && diff.mRemoved.size() == 1);
+    CHECK(diff.mRemoved[0].mId == coins && diff.mChanged[0].mText == "Gems" && diff.mChanged[0].mId != coins);
+    CHECK(client.shows(lines));
+
+    // Removed lines only send their removal.
+    lines.pop_back();
+    diff = state.update("Stats", lines, 1);
+    client.apply(diff);
+    CHECK(!diff.mDisplay && diff.mChanged.empty() && diff.mRemoved.size() == 1);
+    CHECK(state.getEntries().size() == 2 && client.shows(lines));
+
+    // A new title displays the objective again with every line, which keep their ids. Lines dropped at the same time
+    // need no removal.
+    lines.pop_back();
+    diff = state.update("Season 2", lines, 1);
+    client.apply(diff);
+    CHECK(diff.mDisplay && diff.mChanged.size() == 1 && diff.mRemoved.empty());
+    CHECK(diff.mChanged[0].mId == kills && state.getTitle() == "Season 2");
+    CHECK(client.shows(lines));
+    diff = state.update("Season 2", lines, 0);
+    CHECK(diff.mDisplay && diff.mChanged.size() == 1 && state.getSortOrder() == 0);
+
+    state.clear();
+    CHECK(!state.isShown() && state.getEntries().empty());
+    diff = state.update("Season 2", lines, 0);
+    CHECK(diff.mDisplay && diff.mChanged.size() == 1 && diff.mChanged[0].mId != kills);
+}
+
+void checkRepeatedTexts() {
+    SidebarState state;
+    Client       client;
+    Lines        lines = {{"-----", 0}, {"Kills", 3}, {"-----", 0}, {std::string("a\0b", 3), 1}, {"a", 2}};
+    client.apply(state.update("Stats", lines, 0));
+    CHECK(state.getEntries().size() == 5 && client.shows(lines));
+    CHECK(getId(state, "-----", 0) != getId(state, "-----", 1));
+    // Dropping one of the separators removes the last occurrence.
+    auto second = getId(state, "-----", 1);
+    lines.erase(lines.begin() + 2);
+    auto diff = state.update("Stats", lines, 0);
+    client.apply(diff);
+    CHECK(diff.mChanged.empty() && diff.mRemoved.size() == 1 && diff.mRemoved[0].mId == second);
+    CHECK(client.shows(lines));
+}
+
+// Random edits, the client always ends up showing the lines.
+void checkRandom() {
+    std::mt19937 random(16);
+    SidebarState state;
+    Client       client;
+    Lines        lines;
+    std::string  title = "Stats";
+    for (int i = 0; i < 20000; i++) {
+        switch (random() % 8) {
+        case 0:
+            if (lines.size() < 15) {
+                auto position = lines.begin() + random() % (lines.size() + 1);
+                lines.insert(position, {"Line " + std::to_string(random() % 20), 0});
+            }
+            break;
+        case 1:
+            if (!lines.empty()) {
+                lines.erase(lines.begin() + random() % lines.size());
+            }
+            break;
+        case 2:
+            if (!lines.empty()) {
+                lines[random() % lines.size()].first = "Line " + std::to_string(random() % 20);
+            }
+            break;
+        case 3:
+            title = random() % 2 ? "Stats" : "Season";
+            break;
+        default:
+            if (!lines.empty()) {
+                lines[random() % lines.size()].second = (int)(random() % 100);
+            }
+            break;
+        }
+        client.apply(state.update(title, lines, 0));
+        CHECK(client.shows(lines));
+        CHECK(state.getEntries().size() == lines.size());
+    }
+}
+
+int main() {
+    checkDiffs();
+    checkRepeatedTexts();
+    checkRandom();
+    return finishTest();
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "Server/ScoreboardAPI/ScoreSnapshot.h"
+#include <map>
+
+// Stands in for the server scoreboard: exported the way exportScores walks it, and imported the way
+// ScoreSnapshotImporter applies a snapshot, scores of ids without an identity are dropped.
+struct StandInScoreboard : GMLIB::ScoreboardAPI::ScoreSnapshotReader::Handler {
+    std::vector<GMLIB::ScoreboardAPI::SnapshotObjective>      mObjectives;
+    std::map<int64_t, GMLIB::ScoreboardAPI::SnapshotIdentity> mIdentities;
+    std::vector<std::map<int64_t, int>>                       mScores; // By objective index
+    size_t                                                    mDroppedScores = 0;
+
+    bool write(std::ostream& stream) const {
+        GMLIB::ScoreboardAPI::ScoreSnapshotWriter writer(stream);
+        for (auto& objective : mObjectives) {
+            writer.addObjective(objective);
+        }
+        for (auto& [id, identity] : mIdentities) {
+            writer.writeIdentity(identity);
+            for (uint32_t objective = 0; objective < mScores.size(); objective++) {
+                auto it = mScores[objective].find(id);
+                if (it != mScores[objective].end()) {
+                    writer.writeScore(objective, id, it->second);
+                }
+            }
+        }
+        return writer.finish();
+    }
+
+    bool onObjective(uint32_t, GMLIB::ScoreboardAPI::SnapshotObjective const& objective) override {
+        mObjectives.push_back(objective);
+        mScores.emplace_back();
+        return true;
+    }
+
+    bool onIdentities(std::vector<GMLIB::ScoreboardAPI::SnapshotIdentity> const& identities) override {
+        for (auto& identity : identities) {
+            mIdentities.insert_or_assign(identity.mId, identity);
+        }
+        return true;
+    }
+
+    bool onScores(uint32_t objective, std::vector<GMLIB::ScoreboardAPI::SnapshotScore> const& scores) override {
+        for (auto& score : scores) {
+            if (mIdentities.count(score.mId)) {
+                mScores[objective].insert_or_assign(score.mId, score.mScore);
+            } else {
+                mDroppedScores++;
+            }
+        }
+        return true;
+    }
+};
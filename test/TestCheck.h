@@ -0,0 +1,21 @@
+#pragma once
+#include <cstdio>
+
+// A failed check is printed and counted, the test keeps running so that every failure is reported.
+inline int mFailures = 0;
+
+#define CHECK(condition)                                                                                               \
+    if (!(condition)) {                                                                                                \
+        std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition);                                      \
+        mFailures++;                                                                                                   \
+    }
+
+// The exit code of the test.
+inline int finishTest() {
+    if (mFailures) {
+        std::printf("%d checks failed\n", mFailures);
+        return 1;
+    }
+    std::printf("All checks passed\n");
+    return 0;
+}
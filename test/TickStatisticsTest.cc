@@ -0,0 +1,137 @@
+#include "Server/LevelAPI/TickStatistics.h"
+#include "TestCheck.h"
+#include <cmath>
+#include <memory>
+
+using namespace GMLIB::LevelAPI;
+
+constexpr uint64_t SECOND = 1000000;
+
+bool isNear(double value, double expected, double relativeError) {
+    return std::abs(value - expected) <= expected * relativeError;
+}
+
+void checkHistogramError() {
+    for (uint32_t value = 0; value < 5000000; value += 1 + value / 64) {
+        auto bucketValue = MsptHistogram::getValueFromIndex(MsptHistogram::getIndex(value));
+        if (value < MsptHistogram::SUB_BUCKET_COUNT) {
+            CHECK(bucketValue == value);
+        } else {
+            CHECK(isNear(bucketValue, value, 1.0 / MsptHistogram::SUB_BUCKET_COUNT));
+        }
+    }
+    CHECK(MsptHistogram::getIndex(UINT32_MAX) < MsptHistogram::BUCKET_COUNT);
+
+    MsptHistogram histogram;
+    CHECK(histogram.getValueAtPercentile(50) == 0);
+    for (uint32_t value = 1; value <= 100; value++) {
+        histogram.record(value * 1000);
+    }
+    CHECK(histogram.getTotalCount() == 100);
+    CHECK(isNear(histogram.getValueAtPercentile(50), 50000, 0.04));
+    CHECK(isNear(histogram.getValueAtPercentile(99), 99000, 0.04));
+    CHECK(isNear(histogram.getValueAtPercentile(100), 100000, 0.04));
+    MsptHistogram copy;
+    copy.add(histogram);
+    copy.subtract(histogram);
+    CHECK(copy.getTotalCount() == 0 && copy.getValueAtPercentile(50) == 0);
+}
+
+void checkRingWraparound() {
+    TickSampleRing<8> ring;
+    TickSample        sample;
+    CHECK(!ring.pop(sample));
+    for (uint64_t i = 0; i < 8; i++) {
+        CHECK(ring.push({i, (uint32_t)i}));
+    }
+    // Full, the newest sample is dropped.
+    CHECK(!ring.push({8, 8}));
+    uint64_t next = 0;
+    uint64_t last = 8;
+    // The indexes wrap around the buffer many times, samples still come out in order.
+    for (int round = 0; round < 1000; round++) {
+        for (int i = 0; i < 3; i++) {
+            CHECK(ring.pop(sample) && sample.mTimestamp == next && sample.mDuration == (uint32_t)next);
+            next++;
+        }
+        for (int i = 0; i < 3; i++) {
+            CHECK(ring.push({last, (uint32_t)last}));
+            last++;
+        }
+    }
+    while (ring.pop(sample)) {
+        CHECK(sample.mTimestamp == next);
+        next++;
+    }
+    CHECK(next == last);
+}
+
+// Records one second of ticks spread evenly over it, and completes it.
+void recordSecond(TickStatistics& statistics, uint64_t second, uint32_t ticks, uint32_t duration, uint32_t slowest) {
+    for (uint32_t i = 0; i < ticks; i++) {
+        CHECK(statistics.recordTick(second * SECOND + i * (SECOND / ticks), i == 0 ? slowest : duration));
+    }
+    statistics.collect((second + 1) * SECOND);
+}
+
+void checkStatistics() {
+    auto     statistics = std::make_unique<TickStatistics>();
+    uint64_t second     = 1000;
+    CHECK(statistics->getTps1s() == TickStatistics::MAX_TPS);
+
+    // 20 TPS, 19 ticks of 10ms and one of 100ms each second.
+    for (int i = 0; i < 90; i++) {
+        recordSecond(*statistics, second++, 20, 10000, 100000);
+    }
+    CHECK(isNear(statistics->getMsptP50(), 10, 0.04));
+    CHECK(isNear(statistics->getMsptP95(), 10, 0.04));
+    CHECK(isNear(statistics->getMsptP99(), 100, 0.04));
+    CHECK(statistics->getMaxMspt() == 100);
+    CHECK(statistics->getTps1s() == 20);
+    CHECK(statistics->getTps10s() == 20);
+    CHECK(statistics->getTps60s() == 20);
+
+    // 10 TPS of 40ms ticks. The 60 second window, kept in a ring of slices, holds both until the old ones expire.
+    for (int i = 0; i < 30; i++) {
+        recordSecond(*statistics, second++, 10, 40000, 40000);
+    }
+    CHECK(statistics->getTps1s() == 10);
+    CHECK(statistics->getTps10s() == 10);
+    CHECK(statistics->getTps60s() == 15);
+    CHECK(statistics->getMaxMspt() == 100);
+    for (int i = 0; i < 30; i++) {
+        recordSecond(*statistics, second++, 10, 40000, 40000);
+    }
+    CHECK(isNear(statistics->getMsptP50(), 40, 0.04));
+    CHECK(isNear(statistics->getMsptP99(), 40, 0.04));
+    CHECK(statistics->getMaxMspt() == 40);
+    CHECK(statistics->getTps60s() == 10);
+
+    // A 5 second stall without ticks.
+    statistics->collect((second + 5) * SECOND);
+    second += 5;
+    CHECK(statistics->getTps1s() == 0);
+    CHECK(statistics->getTps10s() == 5);
+    CHECK(isNear(statistics->getTps60s(), 55.0 * 10 / 60, 0.001));
+
+    // A stall longer than the window leaves nothing in it.
+    second += 1000;
+    statistics->collect(second * SECOND);
+    CHECK(statistics->getTps60s() == 0);
+    CHECK(statistics->getMsptP50() == 0);
+    CHECK(statistics->getMaxMspt() == 0);
+
+    // Samples of a second that already passed are counted into the current one.
+    recordSecond(*statistics, second, 20, 10000, 10000);
+    CHECK(statistics->getTps1s() == 20);
+    CHECK(statistics->recordTick((second - 3) * SECOND, 10000));
+    statistics->collect((second + 2) * SECOND);
+    CHECK(statistics->getTps1s() == 1);
+}
+
+int main() {
+    checkHistogramError();
+    checkRingWraparound();
+    checkStatistics();
+    return finishTest();
+}
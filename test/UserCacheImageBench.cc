@@ -0,0 +1,71 @@
+#include "Server/UserCache/UserCacheImage.h"
+#include "UserCacheRecords.h"
+
+using namespace GMLIB::Server::UserCache;
+
+// Usage: UserCacheImageBench [record count...]
+// Writes a binary user cache, maps it, and looks every player up in place by uuid, xuid and name.
+int main(int argc, char** argv) {
+    auto path = std::filesystem::temp_directory_path() / "gmlib_usercache_image_bench.bin";
+    for (auto count : getBenchCounts(argc, argv)) {
+        auto                             records = makeUserCacheRecords(count);
+        std::vector<UserCacheRecordView> views;
+        views.reserve(count);
+        for (auto& record : records) {
+            views.push_back({record.mUuid, record.mXuid, record.mRealName});
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        if (!UserCacheImage::write(path, views)) {
+            return 1;
+        }
+        auto writeTime = getMilliseconds(start);
+
+        start = std::chrono::steady_clock::now();
+        UserCacheImage image;
+        if (!image.open(path)) {
+            return 1;
+        }
+        auto openTime = getMilliseconds(start);
+
+        std::vector<size_t> order(count);
+        for (size_t i = 0; i < count; i++) {
+            order[i] = (i * 7919) % count;
+        }
+        size_t found = 0;
+        start        = std::chrono::steady_clock::now();
+        for (auto i : order) {
+            found += image.findByUuid(records[i].mUuid) == i;
+        }
+        auto uuidTime = getMilliseconds(start);
+        start         = std::chrono::steady_clock::now();
+        for (auto i : order) {
+            found += image.findByXuid(records[i].mXuid) != UserCacheImage::npos;
+        }
+        auto xuidTime = getMilliseconds(start);
+        start         = std::chrono::steady_clock::now();
+        for (auto i : order) {
+            found += image.findByName(records[i].mRealName) != UserCacheImage::npos;
+        }
+        auto nameTime = getMilliseconds(start);
+        start         = std::chrono::steady_clock::now();
+        for (auto i : order) {
+            found += image.findByUuid(records[i].mUuid + "x") == UserCacheImage::npos;
+        }
+        auto missTime = getMilliseconds(start);
+        if (found != count * 4) {
+            std::printf("Found %zu of %zu lookups\n", found, count * 4);
+            return 1;
+        }
+
+        std::printf("%zu records, %ju bytes\n", count, (uintmax_t)std::filesystem::file_size(path));
+        std::printf("  write:          %.1f ms\n", writeTime);
+        std::printf("  open:           %.3f ms\n", openTime);
+        std::printf("  lookup by uuid: %.1f ns\n", uuidTime * 1e6 / (double)count);
+        std::printf("  lookup by xuid: %.1f ns\n", xuidTime * 1e6 / (double)count);
+        std::printf("  lookup by name: %.1f ns\n", nameTime * 1e6 / (double)count);
+        std::printf("  missing uuid:   %.1f ns\n", missTime * 1e6 / (double)count);
+    }
+    std::filesystem::remove(path);
+    return 0;
+}
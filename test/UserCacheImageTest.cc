@@ -0,0 +1,72 @@
+#include "Server/UserCache/UserCacheImage.h"
+#include "TestCheck.h"
+#include <fstream>
+
+using namespace GMLIB::Server::UserCache;
+
+void checkLookups(std::filesystem::path const& path) {
+    std::vector<UserCacheRecordView> records = {
+        {"uuid-a", "1", "Alex" },
+        {"uuid-b", "2", "Steve"},
+        {"uuid-c", "",  "Alex" },
+        {"uuid-d", "4", ""     },
+        {"uuid-e", "5", "Alex" },
+    };
+    CHECK(UserCacheImage::write(path, records));
+    UserCacheImage image;
+    CHECK(image.open(path) && image.size() == records.size());
+    CHECK(image.findByUuid("uuid-c") == 2);
+    CHECK(image.findByXuid("4") == 3);
+    CHECK(image.findByXuid("") == UserCacheImage::npos);
+    CHECK(image.findByName("") == UserCacheImage::npos);
+    CHECK(image.findByName("Steve") == 1);
+    CHECK(image.findByName("Herobrine") == UserCacheImage::npos);
+    // The last written holder of a name wins, the others are found once it is rejected.
+    CHECK(image.findByName("Alex") == 4);
+    CHECK(image.findByName("Alex", [](size_t index) { return index != 4; }) == 2);
+    CHECK(image.findByName("Alex", [](size_t index) { return index == 0; }) == 0);
+    CHECK(image.findByName("Alex", [](size_t) { return false; }) == UserCacheImage::npos);
+    CHECK(image.at(4).mUuid == "uuid-e" && image.at(4).mXuid == "5" && image.at(4).mRealName == "Alex");
+}
+
+void checkManyHolders(std::filesystem::path const& path) {
+    std::vector<std::string> uuids;
+    for (int i = 0; i < 1000; i++) {
+        uuids.push_back("uuid-" + std::to_string(i));
+    }
+    std::vector<UserCacheRecordView> records;
+    for (int i = 0; i < 1000; i++) {
+        records.push_back({uuids[i], "", i % 3 ? "Shared" : std::string_view(uuids[i])});
+    }
+    CHECK(UserCacheImage::write(path, records));
+    UserCacheImage image;
+    CHECK(image.open(path));
+    CHECK(image.findByName("Shared") == 998);
+    CHECK(image.findByName("Shared", [](size_t index) { return index < 500; }) == 499);
+    for (int i = 0; i < 1000; i += 3) {
+        CHECK(image.findByName(uuids[i]) == (size_t)i);
+    }
+}
+
+void checkRejected(std::filesystem::path const& path) {
+    CHECK(UserCacheImage::write(path, {{"uuid-a", "1", "Alex"}}));
+    auto size = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, size - 1);
+    UserCacheImage image;
+    CHECK(!image.open(path));
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << "not a user cache image";
+    }
+    CHECK(!image.open(path));
+    CHECK(!image.open(path.string() + ".missing"));
+}
+
+int main() {
+    auto path = std::filesystem::temp_directory_path() / "gmlib_usercache_image_test.bin";
+    checkLookups(path);
+    checkManyHolders(path);
+    checkRejected(path);
+    std::filesystem::remove(path);
+    return finishTest();
+}
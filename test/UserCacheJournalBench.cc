@@ -0,0 +1,80 @@
+#include "Server/UserCache/UserCacheJournal.h"
+#include "UserCacheRecords.h"
+
+using namespace GMLIB::Server::UserCache;
+
+// Usage: UserCacheJournalBench [record count...]
+// Writes a json user cache through the journal, loads it back into a table, looks every player up, and renames 1%
+// of them through the journal.
+int main(int argc, char** argv) {
+    auto directory = std::filesystem::temp_directory_path() / "gmlib_usercache_journal_bench";
+    for (auto count : getBenchCounts(argc, argv)) {
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        auto jsonPath    = directory / "usercache.json";
+        auto binaryPath  = directory / "usercache.bin";
+        auto journalPath = directory / "usercache.journal";
+        auto records     = makeUserCacheRecords(count);
+
+        auto start = std::chrono::steady_clock::now();
+        {
+            UserCacheJournal journal(jsonPath, binaryPath, journalPath, count + 1, UserCacheFormat::Json);
+            UserCacheTable   table;
+            journal.load(table);
+            journal.start();
+            for (auto& record : records) {
+                journal.append(record);
+            }
+            journal.stop();
+        }
+        auto writeTime = getMilliseconds(start);
+
+        start = std::chrono::steady_clock::now();
+        UserCacheJournal journal(jsonPath, binaryPath, journalPath, count + 1, UserCacheFormat::Json);
+        UserCacheTable   table;
+        journal.load(table);
+        auto loadTime = getMilliseconds(start);
+        if (table.size() != count) {
+            std::printf("Loaded %zu of %zu records\n", table.size(), count);
+            return 1;
+        }
+
+        std::vector<size_t> order(count);
+        for (size_t i = 0; i < count; i++) {
+            order[i] = (i * 7919) % count;
+        }
+        size_t found = 0;
+        start        = std::chrono::steady_clock::now();
+        for (auto i : order) {
+            found += table.tryGetByUuid(records[i].mUuid) != nullptr;
+        }
+        auto uuidTime = getMilliseconds(start);
+        start         = std::chrono::steady_clock::now();
+        for (auto i : order) {
+            found += table.tryGetByName(records[i].mRealName) != nullptr;
+        }
+        auto nameTime = getMilliseconds(start);
+        if (found != count * 2) {
+            return 1;
+        }
+
+        start = std::chrono::steady_clock::now();
+        journal.start();
+        for (size_t i = 0; i < count / 100; i++) {
+            auto record       = records[order[i]];
+            record.mRealName += "_";
+            journal.append(std::move(record));
+        }
+        journal.stop();
+        auto renameTime = getMilliseconds(start);
+
+        std::printf("%zu records\n", count);
+        std::printf("  write through journal: %.1f ms\n", writeTime);
+        std::printf("  load json:             %.1f ms\n", loadTime);
+        std::printf("  lookup by uuid:        %.1f ns\n", uuidTime * 1e6 / (double)count);
+        std::printf("  lookup by name:        %.1f ns\n", nameTime * 1e6 / (double)count);
+        std::printf("  rename 1%% and compact: %.1f ms\n", renameTime);
+    }
+    std::filesystem::remove_all(directory);
+    return 0;
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include "Server/UserCache/UserCacheTable.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+// Generated players for the user cache benchmarks, the same for every run. Names come from a few thousand syllable
+// words, so that some are shared and many share prefixes and trigrams, like real gamertags.
+inline std::vector<GMLIB::Server::UserCache::UserCacheRecord> makeUserCacheRecords(size_t count) {
+    std::mt19937_64          random(count);
+    std::vector<std::string> words;
+    constexpr char           consonants[] = "bcdfghjklmnprstvwxz";
+    constexpr char           vowels[]     = "aeiouy";
+    for (int i = 0; i < 5000; i++) {
+        std::string word;
+        for (int syllables = 2 + (int)(random() % 3); syllables > 0; syllables--) {
+            word += consonants[random() % (sizeof(consonants) - 1)];
+            word += vowels[random() % (sizeof(vowels) - 1)];
+        }
+        if (random() % 2) {
+            word[0] = (char)(word[0] - 'a' + 'A');
+        }
+        words.push_back(word);
+    }
+    std::vector<GMLIB::Server::UserCache::UserCacheRecord> records(count);
+    for (auto& record : records) {
+        char uuid[37];
+        std::snprintf(
+            uuid,
+            sizeof(uuid),
+            "%08llx-%04llx-%04llx-%04llx-%012llx",
+            (unsigned long long)(random() & 0xffffffff),
+            (unsigned long long)(random() & 0xffff),
+            (unsigned long long)(random() & 0xffff),
+            (unsigned long long)(random() & 0xffff),
+            (unsigned long long)(random() & 0xffffffffffff)
+        );
+        record.mUuid     = uuid;
+        record.mXuid     = std::to_string(2535400000000000ull + random() % 100000000000ull);
+        record.mRealName = words[random() % words.size()];
+        if (random() % 2) {
+            record.mRealName += words[random() % words.size()];
+        }
+        if (random() % 2) {
+            record.mRealName += std::to_string(random() % 100);
+        }
+    }
+    return records;
+}
+
+inline double getMilliseconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Counts given on the command line, 10k, 100k and 1M otherwise.
+inline std::vector<size_t> getBenchCounts(int argc, char** argv) {
+    std::vector<size_t> counts;
+    for (int i = 1; i < argc; i++) {
+        counts.push_back(std::strtoull(argv[i], nullptr, 10));
+    }
+    if (counts.empty()) {
+        counts = {10000, 100000, 1000000};
+    }
+    return counts;
+}
@@ -0,0 +1,135 @@
+#include "Server/UserCache/UserCacheTable.h"
+#include "Server/UserCache/UserNameIndex.h"
+#include "TestCheck.h"
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+
+using namespace GMLIB::Server::UserCache;
+
+// Readers against a login simulator, with the locking of UserCache.cc: logins queue records, the publisher applies
+// them in batches under the unique lock and readers copy their results out under the shared lock.
+// Build with -DGMLIB_TEST_TSAN=ON to run it under ThreadSanitizer.
+
+constexpr int PLAYER_COUNT = 2000;
+constexpr int LOGIN_COUNT  = 100000;
+constexpr int READER_COUNT = 8;
+
+UserCacheTable               mUserCache;
+UserNameIndex                mUserNameIndex;
+std::shared_mutex            mUserCacheMutex;
+std::mutex                   mPendingMutex;
+std::vector<UserCacheRecord> mPendingRecords;
+std::atomic<bool>            mLoginsDone = false;
+std::atomic<int>             mTornRecords;
+std::atomic<long>            mReads;
+
+// Every login of a player writes a new generation of both its xuid and its name, a record mixing two generations
+// is torn.
+UserCacheRecord makeRecord(int login) {
+    auto player     = std::to_string(login % PLAYER_COUNT);
+    auto generation = std::to_string(login / PLAYER_COUNT);
+    return {"uuid-" + player, player + "-" + generation, "Player" + player + "_" + generation};
+}
+
+bool isConsistent(UserCacheRecord const& record) {
+    auto player     = record.mUuid.substr(5);
+    auto separator  = record.mXuid.find('-');
+    auto generation = record.mXuid.substr(separator + 1);
+    return separator != std::string::npos && record.mXuid.substr(0, separator) == player
+        && record.mRealName == "Player" + player + "_" + generation;
+}
+
+int getGeneration(UserCacheRecord const& record) { return std::stoi(record.mXuid.substr(record.mXuid.find('-') + 1)); }
+
+void publish(bool wait) {
+    std::unique_lock lock(mUserCacheMutex, std::defer_lock);
+    if (wait) {
+        lock.lock();
+    } else if (!lock.try_lock()) {
+        return;
+    }
+    std::vector<UserCacheRecord> records;
+    {
+        std::lock_guard pendingLock(mPendingMutex);
+        records.swap(mPendingRecords);
+    }
+    for (auto& record : records) {
+        mUserCache.update(record.mUuid, record.mXuid, record.mRealName);
+        mUserNameIndex.update(record.mUuid, record.mRealName);
+    }
+}
+
+void readPlayers(int seed) {
+    std::vector<int> lastGenerations(PLAYER_COUNT, -1);
+    long             reads = 0;
+    for (int i = seed; !mLoginsDone; i += 7) {
+        auto                           player = i % PLAYER_COUNT;
+        std::optional<UserCacheRecord> byUuid;
+        std::optional<UserCacheRecord> byName;
+        {
+            std::shared_lock lock(mUserCacheMutex);
+            if (auto record = mUserCache.tryGetByUuid("uuid-" + std::to_string(player))) {
+                byUuid = *record;
+                if (auto named = mUserCache.tryGetByName(record->mRealName)) {
+                    byName = *named;
+                }
+            }
+            if (i % 64 == 0) {
+                mUserNameIndex.findByPrefix("Player" + std::to_string(player), 5);
+            }
+        }
+        reads++;
+        if (!byUuid) {
+            continue;
+        }
+        // Generations of a player only move forward.
+        auto generation = getGeneration(*byUuid);
+        if (!isConsistent(*byUuid) || generation < lastGenerations[player]
+            || (byName && byName->mUuid != byUuid->mUuid)) {
+            mTornRecords++;
+        }
+        lastGenerations[player] = generation;
+    }
+    mReads += reads;
+}
+
+int main() {
+    std::vector<std::thread> readers;
+    for (int i = 0; i < READER_COUNT; i++) {
+        readers.emplace_back(readPlayers, i);
+    }
+    std::thread publisher([] {
+        while (!mLoginsDone) {
+            publish(false);
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    });
+    for (int i = 0; i < LOGIN_COUNT; i++) {
+        auto            record = makeRecord(i);
+        std::lock_guard lock(mPendingMutex);
+        mPendingRecords.push_back(std::move(record));
+    }
+    // Leaves the readers time to see later batches.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    mLoginsDone = true;
+    publisher.join();
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    publish(true);
+
+    CHECK(mTornRecords == 0);
+    CHECK(mUserCache.size() == PLAYER_COUNT);
+    CHECK(mUserNameIndex.size() == PLAYER_COUNT);
+    for (int i = LOGIN_COUNT - PLAYER_COUNT; i < LOGIN_COUNT; i++) {
+        auto expected = makeRecord(i);
+        auto record   = mUserCache.tryGetByUuid(expected.mUuid);
+        CHECK(record && record->mXuid == expected.mXuid && record->mRealName == expected.mRealName);
+        CHECK(mUserCache.tryGetByName(expected.mRealName) == record);
+    }
+    std::printf("%ld reads\n", (long)mReads);
+    return finishTest();
+}
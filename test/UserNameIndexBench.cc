@@ -0,0 +1,52 @@
+#include "Server/UserCache/UserNameIndex.h"
+#include "UserCacheRecords.h"
+
+using namespace GMLIB::Server::UserCache;
+
+// Usage: UserNameIndexBench [record count...]
+// Builds the name index, then searches by prefix and by names with one typo.
+int main(int argc, char** argv) {
+    constexpr size_t QUERY_COUNT = 1000;
+    for (auto count : getBenchCounts(argc, argv)) {
+        auto records = makeUserCacheRecords(count);
+
+        auto          start = std::chrono::steady_clock::now();
+        UserNameIndex index;
+        for (auto& record : records) {
+            index.update(record.mUuid, record.mRealName);
+        }
+        auto buildTime = getMilliseconds(start);
+
+        std::mt19937_64          random(count);
+        std::vector<std::string> prefixes;
+        std::vector<std::string> typos;
+        for (size_t i = 0; i < QUERY_COUNT; i++) {
+            auto& name = records[random() % count].mRealName;
+            prefixes.push_back(name.substr(0, 4));
+            auto typo                    = name;
+            typo[random() % typo.size()] = 'q';
+            typos.push_back(typo);
+        }
+        size_t found = 0;
+        start        = std::chrono::steady_clock::now();
+        for (auto& prefix : prefixes) {
+            found += !index.findByPrefix(prefix, 10).empty();
+        }
+        auto prefixTime = getMilliseconds(start);
+        start           = std::chrono::steady_clock::now();
+        for (auto& typo : typos) {
+            found += !index.findSimilar(typo, 10, 2).empty();
+        }
+        auto similarTime = getMilliseconds(start);
+        if (found != QUERY_COUNT * 2) {
+            std::printf("Found %zu of %zu searches\n", found, QUERY_COUNT * 2);
+            return 1;
+        }
+
+        std::printf("%zu names\n", count);
+        std::printf("  build:        %.1f ms\n", buildTime);
+        std::printf("  prefix:       %.2f us\n", prefixTime * 1000 / QUERY_COUNT);
+        std::printf("  one typo:     %.2f us\n", similarTime * 1000 / QUERY_COUNT);
+    }
+    return 0;
+}
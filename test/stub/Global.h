@@ -0,0 +1,21 @@
+#pragma once
+#include <cstdio>
+#include <string>
+
+// Stands in for src/Global.h in the tests, for the engine independent sources that only need the logger.
+struct TestLogger {
+    template <typename... Args>
+    void error(std::string const& format, Args&&...) {
+        std::printf("[error] %s\n", format.c_str());
+    }
+
+    template <typename... Args>
+    void warn(std::string const& format, Args&&...) {
+        std::printf("[warn] %s\n", format.c_str());
+    }
+
+    template <typename... Args>
+    void info(std::string const&, Args&&...) {}
+};
+
+inline TestLogger logger;